@@ -0,0 +1,266 @@
+##  Z4GE.Configuration
+##  Copyright 2022 DeathBlizzard
+##  
+##  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+##  conditions are met:
+##  
+##  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+##      disclaimer.Configuration
+##  
+##  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+##      disclaimer in the documentation and/or other materials provided with the distribution.
+##  
+##  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+##      derived from this software without specific prior written permission.
+##  
+##  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+##  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+##  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+##  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+##  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+##  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+##  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+##  Compile-time Benchmark
+##  Measures the frontend cost of including the Z4GE.Configuration headers. This file is a CMake script that is run by the
+##  `CompileTimeBenchmark_Z4GEConfiguration` target (`cmake -P`) and expects the following variables
+##
+##  Z4GE_BENCHMARK_COMPILER             -   C++ compiler to benchmark
+##  Z4GE_BENCHMARK_COMPILER_ID          -   CMAKE_CXX_COMPILER_ID of the compiler (GNU and Clang are supported)
+##  Z4GE_BENCHMARK_COMPILER_VERSION     -   CMAKE_CXX_COMPILER_VERSION of the compiler
+##  Z4GE_BENCHMARK_FLAGS                -   Compiler flags of the translation units
+##  Z4GE_BENCHMARK_SOURCE_DIRECTORY     -   Root directory of the Z4GE.Configuration package
+##  Z4GE_BENCHMARK_OUTPUT_DIRECTORY     -   Directory of the synthetic translation units and the JSON summary
+##  Z4GE_BENCHMARK_UNITS                -   Maximum number of translation units (N)
+##  Z4GE_BENCHMARK_HEADERS              -   Headers included by the translation units (Z4GE/Configuration/CompilerTraits.hh by
+##                                          default)
+##  Z4GE_BENCHMARK_REPETITIONS          -   Number of runs of every batch, the fastest is kept (5 by default)
+##
+##  Every synthetic translation unit includes the headers and expands each object-like Z4GE_* macro that they define, along
+##  with the commonly used function-like macros. Batches of 1, 2, 4, ... N units are checked (`-fsyntax-only`) by a single
+##  compiler invocation, which is timed by the wall clock, and so are batches of as many empty baseline units. The results
+##  are written to `<Z4GE_BENCHMARK_OUTPUT_DIRECTORY>/CompileTime.json`:
+##
+##      include_us      -   Time spent in the headers and the macro expansions (frontend_us - baseline_us)
+##      frontend_us     -   Time spent checking the units
+##      baseline_us     -   Time spent checking the baseline units, ie. the startup cost of the compiler
+##      definitions     -   Number of Z4GE_* macros defined by the headers
+##      expansions      -   Number of macros expanded by a single unit (Clang only, null otherwise)
+##      lines           -   Number of lines of a single preprocessed unit
+##
+##  The summary also records the commit of the source tree, so that summaries of two commits can be compared directly.
+##  Microsecond timestamps require CMake 3.23
+cmake_minimum_required(VERSION 3.11.0)
+
+foreach(VARIABLE COMPILER COMPILER_ID FLAGS SOURCE_DIRECTORY OUTPUT_DIRECTORY UNITS)
+    if(NOT DEFINED Z4GE_BENCHMARK_${VARIABLE})
+        message(FATAL_ERROR "[CompileTimeBenchmark] Z4GE_BENCHMARK_${VARIABLE} is required")
+    endif()
+endforeach()
+if(NOT Z4GE_BENCHMARK_HEADERS)
+    set(Z4GE_BENCHMARK_HEADERS Z4GE/Configuration/CompilerTraits.hh)
+endif()
+if(NOT Z4GE_BENCHMARK_REPETITIONS)
+    set(Z4GE_BENCHMARK_REPETITIONS 5)
+endif()
+if(CMAKE_VERSION VERSION_LESS 3.23)
+    message(FATAL_ERROR "[CompileTimeBenchmark] CMake 3.23 or newer is required for microsecond timestamps")
+endif()
+if(NOT Z4GE_BENCHMARK_COMPILER_ID MATCHES "^(GNU|Clang|AppleClang)$")
+    message(FATAL_ERROR "[CompileTimeBenchmark] ${Z4GE_BENCHMARK_COMPILER_ID} is not supported, use GCC or Clang")
+endif()
+
+set(BENCHMARK_FLAGS ${Z4GE_BENCHMARK_FLAGS} -I${Z4GE_BENCHMARK_SOURCE_DIRECTORY}/Include)
+set(BENCHMARK_DIRECTORY ${Z4GE_BENCHMARK_OUTPUT_DIRECTORY}/CompileTime)
+file(REMOVE_RECURSE ${BENCHMARK_DIRECTORY})
+file(MAKE_DIRECTORY ${BENCHMARK_DIRECTORY})
+
+##  Runs the compiler and fails the benchmark with its diagnostics if the compilation fails
+function(benchmark_compile OUTPUT ERROR)
+    execute_process(
+        COMMAND ${Z4GE_BENCHMARK_COMPILER} ${BENCHMARK_FLAGS} ${ARGN}
+        WORKING_DIRECTORY ${BENCHMARK_DIRECTORY}
+        RESULT_VARIABLE COMPILE_RESULT
+        OUTPUT_VARIABLE COMPILE_OUTPUT
+        ERROR_VARIABLE  COMPILE_ERROR
+    )
+    if(NOT COMPILE_RESULT EQUAL 0)
+        message(FATAL_ERROR "[CompileTimeBenchmark] Unable to compile the benchmark\n${COMPILE_ERROR}")
+    endif()
+    set(${OUTPUT} "${COMPILE_OUTPUT}" PARENT_SCOPE)
+    set(${ERROR} "${COMPILE_ERROR}" PARENT_SCOPE)
+endfunction()
+
+##  Public macros
+##  The object-like Z4GE_* macros are collected from the headers themselves, except for include guards and macros whose
+##  expansion contains a pragma
+set(INCLUDES "")
+foreach(HEADER IN LISTS Z4GE_BENCHMARK_HEADERS)
+    string(APPEND INCLUDES "#include <${HEADER}>\n")
+endforeach()
+file(WRITE ${BENCHMARK_DIRECTORY}/Definitions.cc "${INCLUDES}")
+benchmark_compile(DEFINITIONS_OUTPUT DEFINITIONS_ERROR -dM -E Definitions.cc)
+
+set(DEFINITIONS 0)
+set(EXPANSIONS "")
+string(REGEX MATCHALL "#define Z4GE_[A-Za-z0-9_]*[^\n]*" DEFINED_MACROS "${DEFINITIONS_OUTPUT}")
+foreach(DEFINED_MACRO IN LISTS DEFINED_MACROS)
+    math(EXPR DEFINITIONS "${DEFINITIONS} + 1")
+    if(DEFINED_MACRO MATCHES "^#define (Z4GE_[A-Za-z0-9_]*) (.+)$")
+        set(MACRO_NAME ${CMAKE_MATCH_1})
+        set(MACRO_EXPANSION "${CMAKE_MATCH_2}")
+        if(NOT MACRO_NAME MATCHES "_HH_$" AND NOT MACRO_EXPANSION MATCHES "_Pragma|__pragma")
+            string(APPEND EXPANSIONS "        Z4GE_BENCHMARK_STRINGIZE (${MACRO_NAME}),\n")
+        endif()
+    endif()
+endforeach()
+
+##  Synthetic translation units
+math(EXPR LAST_UNIT "${Z4GE_BENCHMARK_UNITS} - 1")
+foreach(UNIT RANGE ${LAST_UNIT})
+    file(WRITE ${BENCHMARK_DIRECTORY}/Unit${UNIT}.cc
+        "${INCLUDES}\n"
+        "#define Z4GE_BENCHMARK_STRINGIZE_(...) #__VA_ARGS__\n"
+        "#define Z4GE_BENCHMARK_STRINGIZE(...)  Z4GE_BENCHMARK_STRINGIZE_(__VA_ARGS__)\n"
+        "\n"
+        "namespace Z4GEBenchmarkUnit${UNIT} {\n"
+        "    extern const char* const Expansions[];\n"
+        "    const char* const Expansions[] = {\n"
+        "${EXPANSIONS}"
+        "        Z4GE_STRINGIFY (Z4GE_BENCHMARK_UNIT)\n"
+        "    };\n"
+        "\n"
+        "    struct Z4GE_ALIGN_AS (16) Aligned { int Value; };\n"
+        "\n"
+        "    int Function (const int* Z4GE_RESTRICT Pointer, int Value);\n"
+        "    int Function (const int* Z4GE_RESTRICT Pointer, int Value) {\n"
+        "#ifdef Z4GE_PREFETCH_READ\n"
+        "        Z4GE_PREFETCH_READ (Pointer, 3);\n"
+        "#endif\n"
+        "        if (Z4GE_LIKELY (Value > 0)) { return Pointer[0]; }\n"
+        "        if (Z4GE_UNLIKELY (Value < 0)) { return static_cast<int> (Z4GE_ALIGN_OF (Aligned)); }\n"
+        "        return static_cast<int> (sizeof (Z4GE_STRINGIZE (Value)));\n"
+        "    }\n"
+        "}\n"
+    )
+endforeach()
+
+##  Preprocessed size of a single unit
+benchmark_compile(PREPROCESSED_OUTPUT PREPROCESSED_ERROR -E -P Unit0.cc)
+string(REGEX MATCHALL "\n" PREPROCESSED_LINES "${PREPROCESSED_OUTPUT}")
+list(LENGTH PREPROCESSED_LINES LINES)
+
+##  Number of macro expansions of a single unit, reported by the preprocessor statistics of Clang
+set(MACRO_EXPANSIONS null)
+if(Z4GE_BENCHMARK_COMPILER_ID MATCHES "Clang")
+    benchmark_compile(STATISTICS_OUTPUT STATISTICS_ERROR -fsyntax-only -Xclang -print-stats Unit0.cc)
+    if(STATISTICS_ERROR MATCHES "([0-9]+)/([0-9]+)/([0-9]+) obj/fn/builtin macros expanded")
+        math(EXPR MACRO_EXPANSIONS "${CMAKE_MATCH_1} + ${CMAKE_MATCH_2} + ${CMAKE_MATCH_3}")
+    endif()
+endif()
+
+##  Wall-clock time of one compiler invocation checking the syntax of the given units, in microseconds
+function(benchmark_batch OUTPUT)
+    string(TIMESTAMP START_US "%s%f" UTC)
+    benchmark_compile(BATCH_OUTPUT BATCH_ERROR -fsyntax-only ${ARGN})
+    string(TIMESTAMP END_US "%s%f" UTC)
+    math(EXPR ELAPSED_US "${END_US} - ${START_US}")
+    set(${OUTPUT} ${ELAPSED_US} PARENT_SCOPE)
+endfunction()
+
+##  Baseline translation units, which only cost the startup of the compiler
+foreach(UNIT RANGE ${LAST_UNIT})
+    file(WRITE ${BENCHMARK_DIRECTORY}/Baseline${UNIT}.cc
+        "namespace Z4GEBenchmarkBaseline${UNIT} {\n"
+        "    int Function (int Value);\n"
+        "}\n"
+    )
+endforeach()
+
+##  Batches of 1, 2, 4, ... N units, each compiled by a single invocation. The fastest of Z4GE_BENCHMARK_REPETITIONS runs is
+##  kept, for the units and for as many baseline units, whose time is subtracted to get the cost of the headers
+set(RUNS "")
+set(BATCH 1)
+while(TRUE)
+    if(BATCH GREATER Z4GE_BENCHMARK_UNITS)
+        set(BATCH ${Z4GE_BENCHMARK_UNITS})
+    endif()
+
+    set(BATCH_UNITS "")
+    set(BATCH_BASELINES "")
+    math(EXPR LAST_BATCH_UNIT "${BATCH} - 1")
+    foreach(UNIT RANGE ${LAST_BATCH_UNIT})
+        list(APPEND BATCH_UNITS Unit${UNIT}.cc)
+        list(APPEND BATCH_BASELINES Baseline${UNIT}.cc)
+    endforeach()
+
+    set(BATCH_FRONTEND_US -1)
+    set(BATCH_BASELINE_US -1)
+    foreach(REPETITION RANGE 1 ${Z4GE_BENCHMARK_REPETITIONS})
+        benchmark_batch(RUN_FRONTEND_US ${BATCH_UNITS})
+        benchmark_batch(RUN_BASELINE_US ${BATCH_BASELINES})
+        if(BATCH_FRONTEND_US LESS 0 OR RUN_FRONTEND_US LESS BATCH_FRONTEND_US)
+            set(BATCH_FRONTEND_US ${RUN_FRONTEND_US})
+        endif()
+        if(BATCH_BASELINE_US LESS 0 OR RUN_BASELINE_US LESS BATCH_BASELINE_US)
+            set(BATCH_BASELINE_US ${RUN_BASELINE_US})
+        endif()
+    endforeach()
+
+    math(EXPR BATCH_INCLUDE_US "${BATCH_FRONTEND_US} - ${BATCH_BASELINE_US}")
+    if(BATCH_INCLUDE_US LESS 0)
+        set(BATCH_INCLUDE_US 0)
+    endif()
+    math(EXPR UNIT_INCLUDE_US "${BATCH_INCLUDE_US} / ${BATCH}")
+    message(STATUS "Z4GE.Configuration    =>  ${BATCH} units, ${BATCH_INCLUDE_US} us in the headers "
+                   "(${UNIT_INCLUDE_US} us per unit)")
+
+    if(RUNS)
+        string(APPEND RUNS ",\n")
+    endif()
+    string(APPEND RUNS
+        "        { \"units\": ${BATCH}, \"include_us\": ${BATCH_INCLUDE_US}, \"frontend_us\": ${BATCH_FRONTEND_US}, "
+        "\"baseline_us\": ${BATCH_BASELINE_US}, \"include_us_per_unit\": ${UNIT_INCLUDE_US} }"
+    )
+
+    if(BATCH EQUAL Z4GE_BENCHMARK_UNITS)
+        break()
+    endif()
+    math(EXPR BATCH "${BATCH} * 2")
+endwhile()
+
+##  Summary
+set(COMMIT "unknown")
+find_package(Git QUIET)
+if(GIT_FOUND)
+    execute_process(
+        COMMAND ${GIT_EXECUTABLE} rev-parse HEAD
+        WORKING_DIRECTORY ${Z4GE_BENCHMARK_SOURCE_DIRECTORY}
+        RESULT_VARIABLE GIT_RESULT
+        OUTPUT_VARIABLE GIT_OUTPUT
+        OUTPUT_STRIP_TRAILING_WHITESPACE
+        ERROR_QUIET
+    )
+    if(GIT_RESULT EQUAL 0)
+        set(COMMIT ${GIT_OUTPUT})
+    endif()
+endif()
+
+string(REPLACE ";" "\", \"" HEADERS "${Z4GE_BENCHMARK_HEADERS}")
+string(REPLACE "\"" "\\\"" FLAGS "${Z4GE_BENCHMARK_FLAGS}")
+string(REPLACE ";" " " FLAGS "${FLAGS}")
+file(WRITE ${Z4GE_BENCHMARK_OUTPUT_DIRECTORY}/CompileTime.json
+    "{\n"
+    "    \"commit\": \"${COMMIT}\",\n"
+    "    \"compiler\": \"${Z4GE_BENCHMARK_COMPILER_ID} ${Z4GE_BENCHMARK_COMPILER_VERSION}\",\n"
+    "    \"flags\": \"${FLAGS}\",\n"
+    "    \"headers\": [\"${HEADERS}\"],\n"
+    "    \"definitions\": ${DEFINITIONS},\n"
+    "    \"expansions\": ${MACRO_EXPANSIONS},\n"
+    "    \"lines\": ${LINES},\n"
+    "    \"runs\": [\n"
+    "${RUNS}\n"
+    "    ]\n"
+    "}\n"
+)
+message(STATUS "Z4GE.Configuration    =>  Compile-time summary written to ${Z4GE_BENCHMARK_OUTPUT_DIRECTORY}/CompileTime.json")
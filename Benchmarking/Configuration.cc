@@ -0,0 +1,213 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/Simd.hh>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//  The kernels below are kept out of line with Z4GE_NOINLINE (this target defines Z4GE_FORCE_INLINE), so that each variant is
+//  compiled once against opaque inputs, the way it would be in a library.
+namespace {
+
+    Z4GE_CONSTEXPR_OR_CONST std::size_t Count = 4096;
+
+    std::vector<float> MakeFloats (void) {
+        std::vector<float> Values (Count);
+        for (std::size_t Index = 0; Index < Count; ++Index) Values[Index] = static_cast<float> (Index % 17) * 0.25f - 2.0f;
+        return Values;
+    }
+
+    /// @brief  One negative value for every 64 values, so that the `< 0` branch is taken ~1.5% of the time
+    std::vector<std::int32_t> MakeBiasedIntegers (void) {
+        std::vector<std::int32_t> Values (Count);
+        for (std::size_t Index = 0; Index < Count; ++Index) {
+            const std::int32_t Value = static_cast<std::int32_t> (Index);
+            Values[Index]            = Index % 64 == 0 ? -Value : Value;
+        }
+        return Values;
+    }
+
+    //  Z4GE_INLINE vs Z4GE_NOINLINE
+    inline Z4GE_INLINE float MultiplyAddInline (float A, float B, float C) Z4GE_NOEXCEPT { return A * B + C; }
+    Z4GE_NOINLINE float MultiplyAddOutOfLine (float A, float B, float C) Z4GE_NOEXCEPT { return A * B + C; }
+
+    Z4GE_NOINLINE float AccumulateInline (const float* Input, std::size_t Size) Z4GE_NOEXCEPT {
+        float Sum = 0.0f;
+        for (std::size_t Index = 0; Index < Size; ++Index) Sum = MultiplyAddInline (Input[Index], 0.5f, Sum);
+        return Sum;
+    }
+
+    Z4GE_NOINLINE float AccumulateOutOfLine (const float* Input, std::size_t Size) Z4GE_NOEXCEPT {
+        float Sum = 0.0f;
+        for (std::size_t Index = 0; Index < Size; ++Index) Sum = MultiplyAddOutOfLine (Input[Index], 0.5f, Sum);
+        return Sum;
+    }
+
+    //  Z4GE_LIKELY / Z4GE_UNLIKELY
+    Z4GE_NOINLINE std::int64_t Rare (std::int32_t Value) Z4GE_NOEXCEPT { return static_cast<std::int64_t> (Value) * 3 - 1; }
+
+    Z4GE_NOINLINE std::int64_t SumUnhinted (const std::int32_t* Input, std::size_t Size) Z4GE_NOEXCEPT {
+        std::int64_t Sum = 0;
+        for (std::size_t Index = 0; Index < Size; ++Index) {
+            if (Input[Index] < 0) {
+                Sum += Rare (Input[Index]);
+            } else {
+                Sum += Input[Index];
+            }
+        }
+        return Sum;
+    }
+
+    Z4GE_NOINLINE std::int64_t SumHinted (const std::int32_t* Input, std::size_t Size) Z4GE_NOEXCEPT {
+        std::int64_t Sum = 0;
+        for (std::size_t Index = 0; Index < Size; ++Index) {
+            if (Z4GE_UNLIKELY (Input[Index] < 0)) {
+                Sum += Rare (Input[Index]);
+            } else {
+                Sum += Input[Index];
+            }
+        }
+        return Sum;
+    }
+
+    Z4GE_NOINLINE std::int64_t SumMisHinted (const std::int32_t* Input, std::size_t Size) Z4GE_NOEXCEPT {
+        std::int64_t Sum = 0;
+        for (std::size_t Index = 0; Index < Size; ++Index) {
+            if (Z4GE_LIKELY (Input[Index] < 0)) {
+                Sum += Rare (Input[Index]);
+            } else {
+                Sum += Input[Index];
+            }
+        }
+        return Sum;
+    }
+
+    //  Z4GE_RESTRICT. Without it, every store to `Output` may modify `*Factor`, which has to be reloaded each iteration
+    Z4GE_NOINLINE void ScaleAddAliased (float* Output, const float* Input, const float* Factor,
+                                        std::size_t Size) Z4GE_NOEXCEPT {
+        for (std::size_t Index = 0; Index < Size; ++Index) Output[Index] += Input[Index] * *Factor;
+    }
+
+    Z4GE_NOINLINE void ScaleAddRestrict (float* Z4GE_RESTRICT Output, const float* Z4GE_RESTRICT Input,
+                                         const float* Z4GE_RESTRICT Factor, std::size_t Size) Z4GE_NOEXCEPT {
+        for (std::size_t Index = 0; Index < Size; ++Index) Output[Index] += Input[Index] * *Factor;
+    }
+
+    //  Z4GE_ALIGN_AS. This target selects SSE2 / NEON through z4ge_target_isa, so that Float32x4 compiles to `movaps` /
+    //  `movups` (`ld1` on ARM) instead of four scalar loads
+    struct Z4GE_ALIGN_AS (64) AlignedFloats {
+        float Values[Count + 16];
+    };
+
+    Z4GE_NOINLINE float SumLoadAligned (const float* Input, std::size_t Size) Z4GE_NOEXCEPT {
+        Z4GE::Simd::Float32x4 Sum = Z4GE::Simd::Float32x4::Zero ();
+        for (std::size_t Index = 0; Index < Size; Index += Z4GE::Simd::Float32x4::Lanes) {
+            Sum = Sum + Z4GE::Simd::Float32x4::LoadAligned (Input + Index);
+        }
+        return Sum.ReduceAdd ();
+    }
+
+    Z4GE_NOINLINE float SumLoad (const float* Input, std::size_t Size) Z4GE_NOEXCEPT {
+        Z4GE::Simd::Float32x4 Sum = Z4GE::Simd::Float32x4::Zero ();
+        for (std::size_t Index = 0; Index < Size; Index += Z4GE::Simd::Float32x4::Lanes) {
+            Sum = Sum + Z4GE::Simd::Float32x4::Load (Input + Index);
+        }
+        return Sum.ReduceAdd ();
+    }
+
+    //  Z4GE_IF_CONSTEXPR vs a runtime branch
+    template<bool Saturate>
+    Z4GE_NOINLINE float TransformStatic (const float* Input, std::size_t Size) Z4GE_NOEXCEPT {
+        float Sum = 0.0f;
+        for (std::size_t Index = 0; Index < Size; ++Index) {
+            float Value = Input[Index] * 2.0f;
+            Z4GE_IF_CONSTEXPR (Saturate) { Value = Value > 1.0f ? 1.0f : Value; }
+            Sum += Value;
+        }
+        return Sum;
+    }
+
+    Z4GE_NOINLINE float TransformDynamic (const float* Input, std::size_t Size, bool Saturate) Z4GE_NOEXCEPT {
+        float Sum = 0.0f;
+        for (std::size_t Index = 0; Index < Size; ++Index) {
+            float Value = Input[Index] * 2.0f;
+            if (Saturate) { Value = Value > 1.0f ? 1.0f : Value; }
+            Sum += Value;
+        }
+        return Sum;
+    }
+
+} // namespace
+
+TEST_CASE ("Z4GE_INLINE vs Z4GE_NOINLINE", "[benchmark]") {
+    const std::vector<float> Input = MakeFloats ();
+
+    BENCHMARK ("Z4GE_INLINE") { return AccumulateInline (Input.data (), Input.size ()); };
+    BENCHMARK ("Z4GE_NOINLINE") { return AccumulateOutOfLine (Input.data (), Input.size ()); };
+}
+
+TEST_CASE ("Z4GE_LIKELY / Z4GE_UNLIKELY on a biased branch", "[benchmark]") {
+    const std::vector<std::int32_t> Input = MakeBiasedIntegers ();
+
+    REQUIRE (SumHinted (Input.data (), Input.size ()) == SumUnhinted (Input.data (), Input.size ()));
+    BENCHMARK ("No hint") { return SumUnhinted (Input.data (), Input.size ()); };
+    BENCHMARK ("Z4GE_UNLIKELY (rare branch)") { return SumHinted (Input.data (), Input.size ()); };
+    BENCHMARK ("Z4GE_LIKELY (rare branch, wrong hint)") { return SumMisHinted (Input.data (), Input.size ()); };
+}
+
+TEST_CASE ("Z4GE_RESTRICT on an aliasing loop", "[benchmark]") {
+    const std::vector<float> Input = MakeFloats ();
+    std::vector<float>       Output (Input.size (), 0.0f);
+    const float              Factor = 0.5f;
+
+    BENCHMARK ("Without Z4GE_RESTRICT") {
+        ScaleAddAliased (Output.data (), Input.data (), &Factor, Input.size ());
+        return Output[0];
+    };
+    BENCHMARK ("Z4GE_RESTRICT") {
+        ScaleAddRestrict (Output.data (), Input.data (), &Factor, Input.size ());
+        return Output[0];
+    };
+}
+
+TEST_CASE ("Z4GE_ALIGN_AS on SIMD loads", "[benchmark]") {
+    const std::vector<float> Values = MakeFloats ();
+    static AlignedFloats     Input;
+    for (std::size_t Index = 0; Index < Count + 16; ++Index) Input.Values[Index] = Values[Index % Count];
+
+    BENCHMARK ("Z4GE_ALIGN_AS (64), LoadAligned") { return SumLoadAligned (Input.Values, Count); };
+    BENCHMARK ("Misaligned by 4 bytes, Load") { return SumLoad (Input.Values + 1, Count); };
+}
+
+TEST_CASE ("Z4GE_IF_CONSTEXPR vs a runtime branch", "[benchmark]") {
+    const std::vector<float> Input    = MakeFloats ();
+    volatile bool            Saturate = true;
+
+    REQUIRE (TransformStatic<true> (Input.data (), Input.size ()) == TransformDynamic (Input.data (), Input.size (), Saturate));
+    BENCHMARK ("Z4GE_IF_CONSTEXPR") { return TransformStatic<true> (Input.data (), Input.size ()); };
+    BENCHMARK ("Runtime branch") { return TransformDynamic (Input.data (), Input.size (), Saturate); };
+}
@@ -0,0 +1,406 @@
+##  Z4GE.Configuration
+##  Copyright 2022 DeathBlizzard
+##  
+##  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+##  conditions are met:
+##  
+##  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+##      disclaimer.Configuration
+##  
+##  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+##      disclaimer in the documentation and/or other materials provided with the distribution.
+##  
+##  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+##      derived from this software without specific prior written permission.
+##  
+##  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+##  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+##  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+##  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+##  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+##  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+##  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+##  Module Guard
+##  Prevent `Z4GEArchitecture` module to be included more than once by the parent CMakeLists.txt
+if(DEFINED Z4GE_ARCHITECTURE_INCLUDED)
+    return()
+endif()
+set(Z4GE_ARCHITECTURE_INCLUDED YES)
+
+include(CheckCXXCompilerFlag)
+
+##  Instruction set levels
+##  Each level maps to the Z4GE_FORCE_*_INTRINSICS definition that selects the matching Z4GE_ARCHITECTURE (see
+##  Z4GE/Configuration/Platform.hh), and to the compiler options that enable the same instructions. Microsoft Visual C++ has
+##  no options for the levels between SSE2 and AVX, whose intrinsics are always available
+set(Z4GE_ISA_LEVELS
+    x86 sse sse2 sse3 ssse3 sse4.1 sse4.2 avx avx2 x86-64-v1 x86-64-v2 x86-64-v3 x86-64-v4 avx512vnni arm neon armv8 native
+)
+
+##  Resolves an instruction set level into its family (x86, arm or native), Z4GE_FORCE_* definition and compiler options
+function(z4ge_isa_level LEVEL FAMILY_OUTPUT DEFINITION_OUTPUT OPTIONS_OUTPUT)
+    set(MSVC_OPTIONS)
+    if(LEVEL STREQUAL "x86")
+        set(DEFINITION Z4GE_FORCE_X86_INTRINSICS)
+    elseif(LEVEL STREQUAL "sse")
+        set(DEFINITION Z4GE_FORCE_SSE_INTRINSICS)
+        set(GNU_OPTIONS -msse)
+        set(MSVC_OPTIONS /arch:SSE)
+    elseif(LEVEL STREQUAL "sse2")
+        set(DEFINITION Z4GE_FORCE_SSE2_INTRINSICS)
+        set(GNU_OPTIONS -msse2)
+        set(MSVC_OPTIONS /arch:SSE2)
+    elseif(LEVEL STREQUAL "sse3")
+        set(DEFINITION Z4GE_FORCE_SSE3_INTRINSICS)
+        set(GNU_OPTIONS -msse3)
+    elseif(LEVEL STREQUAL "ssse3")
+        set(DEFINITION Z4GE_FORCE_SSSE3_INTRINSICS)
+        set(GNU_OPTIONS -mssse3)
+    elseif(LEVEL STREQUAL "sse4.1")
+        set(DEFINITION Z4GE_FORCE_SSE41_INTRINSICS)
+        set(GNU_OPTIONS -msse4.1)
+    elseif(LEVEL STREQUAL "sse4.2")
+        set(DEFINITION Z4GE_FORCE_SSE42_INTRINSICS)
+        set(GNU_OPTIONS -msse4.2)
+    elseif(LEVEL STREQUAL "avx")
+        set(DEFINITION Z4GE_FORCE_AVX_INTRINSICS)
+        set(GNU_OPTIONS -mavx)
+        set(MSVC_OPTIONS /arch:AVX)
+    elseif(LEVEL STREQUAL "avx2")
+        set(DEFINITION Z4GE_FORCE_AVX2_INTRINSICS)
+        set(GNU_OPTIONS -mavx2)
+        set(MSVC_OPTIONS /arch:AVX2)
+    elseif(LEVEL STREQUAL "x86-64-v1")
+        set(DEFINITION Z4GE_FORCE_SSE2_INTRINSICS)
+        set(GNU_OPTIONS -march=x86-64)
+    elseif(LEVEL STREQUAL "x86-64-v2")
+        set(DEFINITION Z4GE_FORCE_X86_64_V2_INTRINSICS)
+        set(GNU_OPTIONS -march=x86-64-v2)
+    elseif(LEVEL STREQUAL "x86-64-v3")
+        set(DEFINITION Z4GE_FORCE_X86_64_V3_INTRINSICS)
+        set(GNU_OPTIONS -march=x86-64-v3)
+        set(MSVC_OPTIONS /arch:AVX2)
+    elseif(LEVEL STREQUAL "x86-64-v4")
+        set(DEFINITION Z4GE_FORCE_X86_64_V4_INTRINSICS)
+        set(GNU_OPTIONS -march=x86-64-v4)
+        set(MSVC_OPTIONS /arch:AVX512)
+    elseif(LEVEL STREQUAL "avx512vnni")
+        set(DEFINITION Z4GE_FORCE_AVX512VNNI_INTRINSICS)
+        set(GNU_OPTIONS -march=x86-64-v4 -mavx512vnni)
+        set(MSVC_OPTIONS /arch:AVX512)
+    elseif(LEVEL STREQUAL "arm")
+        set(DEFINITION Z4GE_FORCE_ARM_INTRINSICS)
+    elseif(LEVEL STREQUAL "neon")
+        set(DEFINITION Z4GE_FORCE_NEON_INTRINSICS)
+        if(NOT CMAKE_SYSTEM_PROCESSOR MATCHES "^(aarch64|arm64|ARM64)$")
+            set(GNU_OPTIONS -mfpu=neon)
+        endif()
+    elseif(LEVEL STREQUAL "armv8")
+        set(DEFINITION Z4GE_FORCE_ARMV8_INTRINSICS)
+        set(GNU_OPTIONS -march=armv8-a)
+    elseif(LEVEL STREQUAL "native")
+        ##  The architecture is then detected from the predefined macros of the compiler
+        set(DEFINITION Z4GE_FORCE_INTRINSICS)
+        set(GNU_OPTIONS -march=native)
+    else()
+        string(REPLACE ";" ", " LEVELS "${Z4GE_ISA_LEVELS}")
+        message(FATAL_ERROR "[z4ge_target_isa] Unknown LEVEL ${LEVEL}, expected one of ${LEVELS}")
+    endif()
+
+    if(LEVEL MATCHES "^(arm|neon|armv8)$")
+        set(${FAMILY_OUTPUT} arm PARENT_SCOPE)
+    elseif(LEVEL STREQUAL "native")
+        set(${FAMILY_OUTPUT} native PARENT_SCOPE)
+    else()
+        set(${FAMILY_OUTPUT} x86 PARENT_SCOPE)
+    endif()
+    set(${DEFINITION_OUTPUT} ${DEFINITION} PARENT_SCOPE)
+    if(MSVC)
+        set(${OPTIONS_OUTPUT} ${MSVC_OPTIONS} PARENT_SCOPE)
+    else()
+        set(${OPTIONS_OUTPUT} ${GNU_OPTIONS} PARENT_SCOPE)
+    endif()
+endfunction()
+
+##  Resolves an instruction set level into its Z4GE_ARCHITECTURE_* mask, eg. sse4.1 => Z4GE_ARCHITECTURE_SSE41
+function(z4ge_isa_architecture LEVEL ARCHITECTURE_OUTPUT)
+    string(REPLACE "." "" ARCHITECTURE ${LEVEL})
+    string(MAKE_C_IDENTIFIER ${ARCHITECTURE} ARCHITECTURE)
+    string(TOUPPER ${ARCHITECTURE} ARCHITECTURE)
+    set(${ARCHITECTURE_OUTPUT} Z4GE_ARCHITECTURE_${ARCHITECTURE} PARENT_SCOPE)
+endfunction()
+
+##  Include directory of the Z4GE headers, for the translation units generated by this module
+get_filename_component(Z4GE_ARCHITECTURE_INCLUDE_DIRECTORY ${CMAKE_CURRENT_LIST_DIR}/../Include ABSOLUTE)
+
+##  Checks whether the processor of the build host executes an instruction set LEVEL, eg. to run the tests that are compiled
+##  for it. The result is cached in Z4GE_HOST_ISA_<LEVEL>_SUPPORTED, and is false when cross compiling
+function(z4ge_host_isa_supported LEVEL SUPPORTED_OUTPUT)
+    string(TOLOWER ${LEVEL} LEVEL)
+    string(MAKE_C_IDENTIFIER "Z4GE_HOST_ISA_${LEVEL}_SUPPORTED" SUPPORTED_VARIABLE)
+    string(TOUPPER ${SUPPORTED_VARIABLE} SUPPORTED_VARIABLE)
+    if(NOT DEFINED ${SUPPORTED_VARIABLE})
+        if(CMAKE_CROSSCOMPILING)
+            set(SUPPORTED OFF)
+        elseif(LEVEL STREQUAL "native")
+            set(SUPPORTED ON)
+        else()
+            ##  The check is compiled for the baseline of the target processor, to report rather than execute the LEVEL
+            z4ge_isa_architecture(${LEVEL} ARCHITECTURE)
+            set(CHECK_DIRECTORY ${CMAKE_BINARY_DIR}${CMAKE_FILES_DIRECTORY}/Z4GEArchitecture)
+            file(WRITE ${CHECK_DIRECTORY}/HostIsaSupported.cc
+                "#include <Z4GE/Configuration/RuntimeArchitecture.hh>\n"
+                "\n"
+                "int main (void) { return Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_HOST_ISA) ? 0 : 1; }\n"
+            )
+            try_run(RUN_RESULT COMPILE_RESULT ${CHECK_DIRECTORY} ${CHECK_DIRECTORY}/HostIsaSupported.cc
+                CMAKE_FLAGS -DINCLUDE_DIRECTORIES=${Z4GE_ARCHITECTURE_INCLUDE_DIRECTORY}
+                COMPILE_DEFINITIONS -DZ4GE_HOST_ISA=${ARCHITECTURE}
+                CXX_STANDARD 11
+            )
+            if(COMPILE_RESULT AND RUN_RESULT EQUAL 0)
+                set(SUPPORTED ON)
+            else()
+                set(SUPPORTED OFF)
+            endif()
+        endif()
+        set(${SUPPORTED_VARIABLE} ${SUPPORTED} CACHE INTERNAL "Build host executes the ${LEVEL} instruction set")
+        message(STATUS "Z4GE.Configuration    =>  Build host supports ${LEVEL}: ${SUPPORTED}")
+    endif()
+    set(${SUPPORTED_OUTPUT} ${${SUPPORTED_VARIABLE}} PARENT_SCOPE)
+endfunction()
+
+##  Adds the startup architecture guard of a target (see Z4GE/Configuration/ArchitectureGuard.hh), in a translation unit
+##  compiled for the baseline of the target processor, so that the guard never executes the instructions it checks for
+function(z4ge_target_isa_guard TARGET LEVEL)
+    get_target_property(GUARD_SOURCE ${TARGET} Z4GE_ISA_GUARD)
+    if(GUARD_SOURCE)
+        return()
+    endif()
+    get_target_property(TARGET_TYPE ${TARGET} TYPE)
+    if(NOT TARGET_TYPE MATCHES "^(EXECUTABLE|SHARED_LIBRARY|MODULE_LIBRARY)$")
+        message(FATAL_ERROR "[z4ge_target_isa] GUARD requires an executable or a shared library, ${TARGET} is a "
+                            "${TARGET_TYPE}")
+    endif()
+
+    set(GUARD_SOURCE ${CMAKE_CURRENT_BINARY_DIR}/${TARGET}ArchitectureGuard.cc)
+    set(GUARD_CONTENT "//  Generated by z4ge_target_isa, do not edit\n#define Z4GE_CONFIGURATION_ARCHITECTURE_GUARD 1\n")
+    if(LEVEL STREQUAL "native")
+        ##  The architecture is only known from the predefined macros of the compiler, which the baseline options would reset
+        set(GUARD_OPTIONS)
+    else()
+        z4ge_isa_architecture(${LEVEL} GUARD_ARCHITECTURE)
+        string(APPEND GUARD_CONTENT "#define Z4GE_ARCHITECTURE_GUARD_REQUIRED ${GUARD_ARCHITECTURE}\n")
+        ##  Source options follow the options of the target. Microsoft Visual C++ has no option to disable /arch
+        set(GUARD_OPTIONS)
+        if(NOT MSVC AND CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64|i[3-6]86|x86|X86)$")
+            if(CMAKE_SIZEOF_VOID_P EQUAL 8)
+                set(GUARD_OPTIONS -march=x86-64)
+            endif()
+            list(APPEND GUARD_OPTIONS -mno-sse3 -mno-popcnt -mno-lzcnt -mno-bmi -mno-bmi2 -mno-f16c -mno-fma -mno-movbe)
+        endif()
+    endif()
+    string(APPEND GUARD_CONTENT "#include <Z4GE/Configuration/ArchitectureGuard.hh>\n")
+    file(WRITE ${GUARD_SOURCE}.in "${GUARD_CONTENT}")
+    configure_file(${GUARD_SOURCE}.in ${GUARD_SOURCE} COPYONLY)
+
+    target_sources(${TARGET} PRIVATE ${GUARD_SOURCE})
+    set_source_files_properties(${GUARD_SOURCE} PROPERTIES INCLUDE_DIRECTORIES ${Z4GE_ARCHITECTURE_INCLUDE_DIRECTORY}
+                                                           COMPILE_OPTIONS "${GUARD_OPTIONS}")
+    set_property(TARGET ${TARGET} PROPERTY Z4GE_ISA_GUARD ${GUARD_SOURCE})
+endfunction()
+
+##  Instruction set options and Z4GE_FORCE_* definitions that are already in effect for a target, which z4ge_target_isa
+##  would contradict
+set(Z4GE_ISA_OPTIONS_REGEX "(^| )(-march=|-mcpu=|-m(sse|ssse|avx|fma|bmi|f16c|lzcnt|popcnt|fpu=neon)|/arch:)[^ ]*")
+set(Z4GE_ISA_DEFINITIONS_REGEX "Z4GE_(FORCE_[A-Z0-9_]*INTRINSICS|FORCE_UNKNOWN_ARCHITECTURE|NO_SIMD_INTRINSICS)")
+
+##  z4ge_target_isa
+##  Compiles a target for an instruction set LEVEL, by setting both the compiler options (`-march` / `-m<isa>` on GCC and
+##  Clang, `/arch` on Microsoft Visual C++) and the Z4GE_FORCE_*_INTRINSICS definition that makes Z4GE_ARCHITECTURE
+##  describe the same instructions. Both are PUBLIC for libraries, since inline functions of the Z4GE headers compiled for
+##  different levels in the same program violate the one definition rule, and PRIVATE for executables.
+##
+##  The configuration fails when the target is already compiled for another level, either by a previous z4ge_target_isa,
+##  by an instruction set option or Z4GE_FORCE_* definition of the target, its directory or CMAKE_CXX_FLAGS, or by a linked
+##  target; when the LEVEL does not match CMAKE_SYSTEM_PROCESSOR; or when the compiler does not accept the options.
+##
+##  GUARD adds a startup check to an executable or shared library, which aborts with the names of the missing features
+##  instead of crashing with an illegal instruction when the executing processor does not support the LEVEL.
+##
+##      z4ge_target_isa(<target> LEVEL <x86|sse|sse2|sse3|ssse3|sse4.1|sse4.2|avx|avx2|x86-64-v1|x86-64-v2|x86-64-v3|
+##                                      x86-64-v4|avx512vnni|arm|neon|armv8|native> [GUARD])
+function(z4ge_target_isa TARGET)
+    cmake_parse_arguments(ISA "GUARD" "LEVEL" "" ${ARGN})
+    if(NOT TARGET ${TARGET})
+        message(FATAL_ERROR "[z4ge_target_isa] ${TARGET} is not a target")
+    endif()
+    if(NOT ISA_LEVEL)
+        message(FATAL_ERROR "[z4ge_target_isa] LEVEL is required")
+    endif()
+    string(TOLOWER ${ISA_LEVEL} ISA_LEVEL)
+    z4ge_isa_level(${ISA_LEVEL} ISA_FAMILY ISA_DEFINITION ISA_OPTIONS)
+
+    ##  The level has to match the target processor
+    if(CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64|i[3-6]86|x86|X86)$")
+        set(PROCESSOR_FAMILY x86)
+    elseif(CMAKE_SYSTEM_PROCESSOR MATCHES "^(arm.*|ARM.*|aarch64)$")
+        set(PROCESSOR_FAMILY arm)
+    else()
+        set(PROCESSOR_FAMILY ${CMAKE_SYSTEM_PROCESSOR})
+    endif()
+    if(NOT ISA_FAMILY STREQUAL "native" AND NOT ISA_FAMILY STREQUAL PROCESSOR_FAMILY)
+        message(FATAL_ERROR "[z4ge_target_isa] LEVEL ${ISA_LEVEL} of ${TARGET} is an ${ISA_FAMILY} level, while the target "
+                            "processor is ${CMAKE_SYSTEM_PROCESSOR}")
+    endif()
+    if(ISA_LEVEL STREQUAL "native" AND (MSVC OR CMAKE_CROSSCOMPILING))
+        message(FATAL_ERROR "[z4ge_target_isa] LEVEL native of ${TARGET} requires GCC or Clang compiling for the host")
+    endif()
+
+    ##  Previous levels of the target and the targets it links
+    get_target_property(PREVIOUS_LEVEL ${TARGET} Z4GE_ISA_LEVEL)
+    if(PREVIOUS_LEVEL STREQUAL ISA_LEVEL)
+        if(ISA_GUARD)
+            z4ge_target_isa_guard(${TARGET} ${ISA_LEVEL})
+        endif()
+        return()
+    elseif(PREVIOUS_LEVEL)
+        message(FATAL_ERROR "[z4ge_target_isa] ${TARGET} is already compiled for ${PREVIOUS_LEVEL}, not ${ISA_LEVEL}")
+    endif()
+    get_target_property(LINKED_TARGETS ${TARGET} LINK_LIBRARIES)
+    foreach(LINKED_TARGET IN LISTS LINKED_TARGETS)
+        if(TARGET ${LINKED_TARGET})
+            get_target_property(LINKED_LEVEL ${LINKED_TARGET} Z4GE_ISA_LEVEL)
+            if(LINKED_LEVEL AND NOT LINKED_LEVEL STREQUAL ISA_LEVEL)
+                message(FATAL_ERROR "[z4ge_target_isa] ${TARGET} links ${LINKED_TARGET}, which is compiled for "
+                                    "${LINKED_LEVEL}, not ${ISA_LEVEL}")
+            endif()
+        endif()
+    endforeach()
+
+    ##  Instruction set options and definitions that were set by other means
+    if(CMAKE_BUILD_TYPE)
+        string(TOUPPER ${CMAKE_BUILD_TYPE} BUILD_TYPE)
+    endif()
+    get_target_property(TARGET_OPTIONS ${TARGET} COMPILE_OPTIONS)
+    get_target_property(TARGET_DEFINITIONS ${TARGET} COMPILE_DEFINITIONS)
+    get_target_property(TARGET_INTERFACE_DEFINITIONS ${TARGET} INTERFACE_COMPILE_DEFINITIONS)
+    get_directory_property(DIRECTORY_OPTIONS COMPILE_OPTIONS)
+    get_directory_property(DIRECTORY_DEFINITIONS COMPILE_DEFINITIONS)
+    foreach(SOURCE CMAKE_CXX_FLAGS CMAKE_CXX_FLAGS_${BUILD_TYPE} TARGET_OPTIONS DIRECTORY_OPTIONS TARGET_DEFINITIONS
+                   TARGET_INTERFACE_DEFINITIONS DIRECTORY_DEFINITIONS)
+        string(REPLACE ";" " " SOURCE_VALUE "${${SOURCE}}")
+        string(REGEX MATCH "${Z4GE_ISA_OPTIONS_REGEX}" CONFLICT "${SOURCE_VALUE}")
+        if(NOT CONFLICT)
+            string(REGEX MATCH "${Z4GE_ISA_DEFINITIONS_REGEX}" CONFLICT "${SOURCE_VALUE}")
+        endif()
+        if(CONFLICT)
+            string(STRIP "${CONFLICT}" CONFLICT)
+            message(FATAL_ERROR "[z4ge_target_isa] ${TARGET} is compiled with ${CONFLICT} (${SOURCE}), which "
+                                "contradicts LEVEL ${ISA_LEVEL}. Remove it and let z4ge_target_isa select the level")
+        endif()
+    endforeach()
+
+    ##  The compiler has to accept the options
+    if(ISA_OPTIONS)
+        string(MAKE_C_IDENTIFIER "Z4GE_ISA_${ISA_LEVEL}_SUPPORTED" SUPPORTED_VARIABLE)
+        string(TOUPPER ${SUPPORTED_VARIABLE} SUPPORTED_VARIABLE)
+        set(CMAKE_REQUIRED_QUIET ON)
+        string(REPLACE ";" " " ISA_FLAGS "${ISA_OPTIONS}")
+        check_cxx_compiler_flag("${ISA_FLAGS}" ${SUPPORTED_VARIABLE})
+        if(NOT ${SUPPORTED_VARIABLE})
+            message(FATAL_ERROR "[z4ge_target_isa] ${CMAKE_CXX_COMPILER_ID} ${CMAKE_CXX_COMPILER_VERSION} does not support "
+                                "${ISA_FLAGS} (LEVEL ${ISA_LEVEL} of ${TARGET})")
+        endif()
+    endif()
+
+    get_target_property(TARGET_TYPE ${TARGET} TYPE)
+    if(TARGET_TYPE STREQUAL "EXECUTABLE")
+        set(ISA_SCOPE PRIVATE)
+    elseif(TARGET_TYPE STREQUAL "INTERFACE_LIBRARY")
+        set(ISA_SCOPE INTERFACE)
+    else()
+        set(ISA_SCOPE PUBLIC)
+    endif()
+    target_compile_options(${TARGET} ${ISA_SCOPE} ${ISA_OPTIONS})
+    target_compile_definitions(${TARGET} ${ISA_SCOPE} ${ISA_DEFINITION})
+    set_property(TARGET ${TARGET} PROPERTY Z4GE_ISA_LEVEL ${ISA_LEVEL})
+    if(ISA_GUARD)
+        z4ge_target_isa_guard(${TARGET} ${ISA_LEVEL})
+    endif()
+    message(STATUS "Z4GE.Configuration    =>  Compiling ${TARGET} for ${ISA_LEVEL} (${ISA_DEFINITION})")
+endfunction()
+
+##  z4ge_add_multi_isa_executable
+##  Builds the executable <name> once per instruction set LEVEL (by default the x86-64 microarchitecture levels), each with
+##  z4ge_target_isa, into the targets <name>_<level> whose files are named <name>.<level> (eg. `Server.x86-64-v3`). The
+##  target <name> is a launcher, compiled for the baseline of the target processor, which replaces itself at startup with
+##  the variant of the most demanding LEVEL that the executing processor supports (see Z4GE/Configuration/Launcher.hh).
+##  The LEVELS are expected from the least to the most demanding one; the first one is launched when none is supported.
+##
+##  The SOURCES and the usage requirements of the variants are held by the interface library <name>Variants, eg.
+##  `target_link_libraries(<name>Variants INTERFACE ...)` links a library into every variant. The variants have to be
+##  installed in the directory of the launcher; they are listed in the Z4GE_ISA_VARIANTS property of the launcher.
+##
+##      z4ge_add_multi_isa_executable(<name> [LEVELS <level>...] SOURCES <source>...)
+function(z4ge_add_multi_isa_executable NAME)
+    cmake_parse_arguments(MULTI_ISA "" "" "LEVELS;SOURCES" ${ARGN})
+    if(NOT MULTI_ISA_SOURCES)
+        message(FATAL_ERROR "[z4ge_add_multi_isa_executable] SOURCES are required")
+    endif()
+    if(NOT MULTI_ISA_LEVELS)
+        set(MULTI_ISA_LEVELS x86-64-v1 x86-64-v2 x86-64-v3 x86-64-v4)
+    endif()
+    list(LENGTH MULTI_ISA_LEVELS LEVEL_COUNT)
+    if(LEVEL_COUNT LESS 2)
+        message(FATAL_ERROR "[z4ge_add_multi_isa_executable] ${NAME} requires at least two LEVELS, use z4ge_target_isa "
+                            "for a single one")
+    endif()
+
+    add_library(${NAME}Variants INTERFACE)
+    foreach(SOURCE IN LISTS MULTI_ISA_SOURCES)
+        get_filename_component(SOURCE ${SOURCE} ABSOLUTE)
+        target_sources(${NAME}Variants INTERFACE ${SOURCE})
+    endforeach()
+
+    ##  The launcher tries the variants from the most demanding one
+    set(VARIANT_TARGETS)
+    set(LAUNCHER_VARIANTS)
+    foreach(LEVEL IN LISTS MULTI_ISA_LEVELS)
+        string(TOLOWER ${LEVEL} LEVEL)
+        if(LEVEL STREQUAL "native")
+            message(FATAL_ERROR "[z4ge_add_multi_isa_executable] LEVEL native of ${NAME} cannot be identified at runtime")
+        endif()
+        string(MAKE_C_IDENTIFIER "${NAME}_${LEVEL}" VARIANT_TARGET)
+        add_executable(${VARIANT_TARGET})
+        set_target_properties(${VARIANT_TARGET} PROPERTIES OUTPUT_NAME ${NAME}.${LEVEL})
+        target_link_libraries(${VARIANT_TARGET} PRIVATE ${NAME}Variants)
+        z4ge_target_isa(${VARIANT_TARGET} LEVEL ${LEVEL})
+        list(APPEND VARIANT_TARGETS ${VARIANT_TARGET})
+
+        z4ge_isa_architecture(${LEVEL} ARCHITECTURE)
+        set(LAUNCHER_VARIANTS "        { ${ARCHITECTURE}, \"${LEVEL}\" },\n${LAUNCHER_VARIANTS}")
+    endforeach()
+
+    set(LAUNCHER_SOURCE ${CMAKE_CURRENT_BINARY_DIR}/${NAME}Launcher.cc)
+    file(WRITE ${LAUNCHER_SOURCE}.in
+        "//  Generated by z4ge_add_multi_isa_executable, do not edit\n"
+        "#include <Z4GE/Configuration/Launcher.hh>\n"
+        "\n"
+        "int main (int ArgumentCount, char** Arguments) {\n"
+        "    static const Z4GE::Configuration::LaunchVariant Variants[] = {\n"
+        "${LAUNCHER_VARIANTS}"
+        "    };\n"
+        "    return Z4GE::Configuration::Launch (ArgumentCount, Arguments, \"${NAME}\", Variants);\n"
+        "}\n"
+    )
+    configure_file(${LAUNCHER_SOURCE}.in ${LAUNCHER_SOURCE} COPYONLY)
+
+    add_executable(${NAME} ${LAUNCHER_SOURCE})
+    target_include_directories(${NAME} PRIVATE ${Z4GE_ARCHITECTURE_INCLUDE_DIRECTORY})
+    set_target_properties(${NAME} PROPERTIES CXX_STANDARD 11 CXX_STANDARD_REQUIRED ON Z4GE_ISA_VARIANTS "${VARIANT_TARGETS}")
+    add_dependencies(${NAME} ${VARIANT_TARGETS})
+    string(REPLACE ";" ", " LEVELS "${MULTI_ISA_LEVELS}")
+    message(STATUS "Z4GE.Configuration    =>  Launching ${NAME} for ${LEVELS}")
+endfunction()
@@ -0,0 +1,486 @@
+##  Z4GE.Configuration
+##  Copyright 2022 DeathBlizzard
+##  
+##  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+##  conditions are met:
+##  
+##  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+##      disclaimer.Configuration
+##  
+##  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+##      disclaimer in the documentation and/or other materials provided with the distribution.
+##  
+##  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+##      derived from this software without specific prior written permission.
+##  
+##  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+##  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+##  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+##  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+##  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+##  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+##  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+##  Module Guard
+##  Prevent `Z4GEOptimization` module to be included more than once by the parent CMakeLists.txt
+if(DEFINED Z4GE_OPTIMIZATION_INCLUDED)
+    return()
+endif()
+set(Z4GE_OPTIMIZATION_INCLUDED YES)
+
+##  Functions record the policies of their definition, which check_ipo_supported and INTERPROCEDURAL_OPTIMIZATION require
+if(POLICY CMP0069)
+    cmake_policy(SET CMP0069 NEW)
+endif()
+include(CheckIPOSupported)
+
+##  Adds compile and link options to a target, for the options that the compiler driver needs at link time as well
+##  (static libraries pass them on to the link of their consumers)
+function(z4ge_add_compile_and_link_options TARGET)
+    target_compile_options(${TARGET} PRIVATE ${ARGN})
+    get_target_property(TARGET_TYPE ${TARGET} TYPE)
+    if(TARGET_TYPE STREQUAL "STATIC_LIBRARY" OR TARGET_TYPE STREQUAL "OBJECT_LIBRARY")
+        set_property(TARGET ${TARGET} APPEND PROPERTY INTERFACE_LINK_LIBRARIES ${ARGN})
+    else()
+        string(REPLACE ";" " " LINK_FLAGS "${ARGN}")
+        set_property(TARGET ${TARGET} APPEND_STRING PROPERTY LINK_FLAGS " ${LINK_FLAGS}")
+    endif()
+endfunction()
+
+##  z4ge_enable_lto
+##  Enables link-time optimization for a target, so that the small functions of the Z4GE packages it links can be inlined
+##  across translation units and packages.
+##
+##  The target is compiled with INTERPROCEDURAL_OPTIMIZATION, which makes CMake archive static libraries with the LTO aware
+##  archiver (`gcc-ar` / `llvm-ar`), along with the following compiler specific options
+##
+##  Clang           -   ThinLTO (`-flto=thin`) by default, or monolithic LTO (`-flto`) with FULL. Static libraries pass the
+##                      same option on to the link of their consumers
+##  GCC             -   `-flto=auto` (`-flto` before GCC 10), which partitions the link-time optimization over the available
+##                      cores. GCC has no ThinLTO, hence THIN falls back to it
+##  Others          -   INTERPROCEDURAL_OPTIMIZATION only (eg. `/GL` and `/LTCG` for Microsoft Visual C++)
+##
+##  When the toolchain does not support link-time optimization, a warning is issued and the target is left untouched.
+##
+##      z4ge_enable_lto(<target> [THIN|FULL])
+function(z4ge_enable_lto TARGET)
+    cmake_parse_arguments(LTO "THIN;FULL" "" "" ${ARGN})
+    if(NOT TARGET ${TARGET})
+        message(FATAL_ERROR "[z4ge_enable_lto] ${TARGET} is not a target")
+    endif()
+    if(LTO_UNPARSED_ARGUMENTS)
+        message(FATAL_ERROR "[z4ge_enable_lto] Unknown arguments: ${LTO_UNPARSED_ARGUMENTS}")
+    endif()
+    if(LTO_THIN AND LTO_FULL)
+        message(FATAL_ERROR "[z4ge_enable_lto] THIN and FULL are mutually exclusive")
+    endif()
+
+    get_target_property(TARGET_TYPE ${TARGET} TYPE)
+    if(NOT TARGET_TYPE MATCHES "^(EXECUTABLE|STATIC_LIBRARY|SHARED_LIBRARY|MODULE_LIBRARY|OBJECT_LIBRARY)$")
+        message(FATAL_ERROR "[z4ge_enable_lto] ${TARGET} is an ${TARGET_TYPE}, which is not compiled")
+    endif()
+
+    ##  The support check configures a project, thus it is done once per build tree
+    if(NOT DEFINED Z4GE_OPTIMIZATION_LTO_SUPPORTED)
+        check_ipo_supported(RESULT LTO_SUPPORTED OUTPUT LTO_OUTPUT LANGUAGES CXX)
+        set(Z4GE_OPTIMIZATION_LTO_SUPPORTED ${LTO_SUPPORTED} CACHE INTERNAL "Whether the C++ toolchain supports LTO")
+        set(Z4GE_OPTIMIZATION_LTO_OUTPUT "${LTO_OUTPUT}" CACHE INTERNAL "Output of the LTO support check")
+    endif()
+    if(NOT Z4GE_OPTIMIZATION_LTO_SUPPORTED)
+        message(WARNING "[z4ge_enable_lto] Link-time optimization is not supported by the toolchain, ${TARGET} is built "
+                        "without it\n${Z4GE_OPTIMIZATION_LTO_OUTPUT}")
+        return()
+    endif()
+
+    set(LTO_OPTIONS)
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang" AND NOT CMAKE_CXX_COMPILER_FRONTEND_VARIANT STREQUAL "MSVC")
+        if(LTO_FULL)
+            set(LTO_OPTIONS -flto)
+            set(LTO_MODE "full")
+        else()
+            set(LTO_OPTIONS -flto=thin)
+            set(LTO_MODE "thin")
+        endif()
+    elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        if(LTO_THIN)
+            message(STATUS "Z4GE.Configuration    =>  GCC has no ThinLTO, ${TARGET} uses partitioned full LTO")
+        endif()
+        if(CMAKE_CXX_COMPILER_VERSION VERSION_LESS 10.1)
+            set(LTO_OPTIONS -flto)
+        else()
+            set(LTO_OPTIONS -flto=auto)
+        endif()
+        set(LTO_MODE "full")
+    else()
+        if(LTO_THIN)
+            message(STATUS "Z4GE.Configuration    =>  ${CMAKE_CXX_COMPILER_ID} has no ThinLTO, ${TARGET} uses full LTO")
+        endif()
+        set(LTO_MODE "full")
+    endif()
+
+    set_property(TARGET ${TARGET} PROPERTY INTERPROCEDURAL_OPTIMIZATION TRUE)
+    if(LTO_OPTIONS)
+        ##  Appended after the options that CMake derives from INTERPROCEDURAL_OPTIMIZATION, hence they take precedence
+        z4ge_add_compile_and_link_options(${TARGET} ${LTO_OPTIONS})
+    endif()
+
+    ##  Static libraries of LTO objects need an archiver with the LTO plugin. CMake finds one along with the compiler, unless
+    ##  the toolchain is installed unusually, in which case the objects would be archived without a symbol table
+    if(TARGET_TYPE STREQUAL "STATIC_LIBRARY" AND CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang" AND NOT APPLE)
+        if(NOT CMAKE_CXX_COMPILER_AR OR NOT CMAKE_CXX_COMPILER_RANLIB)
+            message(FATAL_ERROR "[z4ge_enable_lto] Unable to find the LTO archiver for ${CMAKE_CXX_COMPILER}, set "
+                                "CMAKE_CXX_COMPILER_AR and CMAKE_CXX_COMPILER_RANLIB to gcc-ar / gcc-ranlib or "
+                                "llvm-ar / llvm-ranlib")
+        endif()
+    endif()
+
+    message(STATUS "Z4GE.Configuration    =>  Enabled ${LTO_MODE} link-time optimization for ${TARGET}")
+endfunction()
+
+##  Profile-guided Optimization
+##  Instrumented profile-guided optimization takes three stages, each a separate configuration of the same build tree. The
+##  stage is usually selected through a cache variable of the project, eg.
+##
+##      if(MY_PGO_STAGE STREQUAL "INSTRUMENT")
+##          z4ge_pgo_instrument(Server)
+##          z4ge_pgo_instrument(ServerCore PROFILE Server)
+##          z4ge_pgo_train(Server COMMAND Server --replay ${CMAKE_SOURCE_DIR}/Traffic.log)
+##      elseif(MY_PGO_STAGE STREQUAL "OPTIMIZE")
+##          z4ge_pgo_optimize(Server)
+##          z4ge_pgo_optimize(ServerCore PROFILE Server)
+##      endif()
+##
+##  followed by building the `TrainProfile_Server` target in the instrumented configuration. A profile is named after the
+##  trained target and stored in `<CMAKE_BINARY_DIR>/Profiles/<profile>`. Libraries that are trained through an executable
+##  refer to the profile of that executable with PROFILE.
+
+##  Directory of a profile
+function(z4ge_pgo_directory PROFILE OUTPUT)
+    set(${OUTPUT} ${CMAKE_BINARY_DIR}/Profiles/${PROFILE} PARENT_SCOPE)
+endfunction()
+
+##  Finds llvm-profdata, preferably the one of the same version and installation as the compiler
+function(z4ge_find_llvm_profdata)
+    get_filename_component(COMPILER_DIRECTORY ${CMAKE_CXX_COMPILER} DIRECTORY)
+    string(REGEX MATCH "^[0-9]+" COMPILER_MAJOR_VERSION "${CMAKE_CXX_COMPILER_VERSION}")
+    find_program(Z4GE_LLVM_PROFDATA NAMES llvm-profdata-${COMPILER_MAJOR_VERSION} llvm-profdata HINTS ${COMPILER_DIRECTORY})
+    if(NOT Z4GE_LLVM_PROFDATA AND APPLE)
+        execute_process(COMMAND xcrun --find llvm-profdata OUTPUT_VARIABLE XCRUN_OUTPUT OUTPUT_STRIP_TRAILING_WHITESPACE)
+        if(XCRUN_OUTPUT)
+            set(Z4GE_LLVM_PROFDATA ${XCRUN_OUTPUT} CACHE FILEPATH "llvm-profdata executable" FORCE)
+        endif()
+    endif()
+    if(NOT Z4GE_LLVM_PROFDATA)
+        message(FATAL_ERROR "[Z4GEOptimization] Unable to find llvm-profdata, set Z4GE_LLVM_PROFDATA")
+    endif()
+endfunction()
+
+##  z4ge_pgo_instrument
+##  Instruments a target for collecting a profile. The instrumented binaries write their profile to the directory of the
+##  PROFILE, the target itself by default (`-fprofile-generate` on GCC, `-fprofile-instr-generate` on Clang).
+##  Instrumentation slows the target down considerably, hence it should only be used for training.
+##
+##      z4ge_pgo_instrument(<target> [PROFILE <profile>])
+function(z4ge_pgo_instrument TARGET)
+    cmake_parse_arguments(PGO "" "PROFILE" "" ${ARGN})
+    if(NOT TARGET ${TARGET})
+        message(FATAL_ERROR "[z4ge_pgo_instrument] ${TARGET} is not a target")
+    endif()
+    if(NOT PGO_PROFILE)
+        set(PGO_PROFILE ${TARGET})
+    endif()
+    z4ge_pgo_directory(${PGO_PROFILE} PROFILE_DIRECTORY)
+
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        ##  Profiles of multi-threaded training runs are only consistent with atomic counter updates
+        set(PGO_OPTIONS -fprofile-generate=${PROFILE_DIRECTORY} -fprofile-update=prefer-atomic)
+    elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang" AND NOT CMAKE_CXX_COMPILER_FRONTEND_VARIANT STREQUAL "MSVC")
+        set(PGO_OPTIONS -fprofile-instr-generate=${PROFILE_DIRECTORY}/Raw/${PGO_PROFILE}-%p.profraw)
+    else()
+        message(FATAL_ERROR "[z4ge_pgo_instrument] Profile-guided optimization is not supported for "
+                            "${CMAKE_CXX_COMPILER_ID}")
+    endif()
+
+    z4ge_add_compile_and_link_options(${TARGET} ${PGO_OPTIONS})
+    set_property(TARGET ${TARGET} PROPERTY Z4GE_PGO_INSTRUMENTED TRUE)
+    message(STATUS "Z4GE.Configuration    =>  Instrumented ${TARGET} for the ${PGO_PROFILE} profile")
+endfunction()
+
+##  z4ge_pgo_train
+##  Adds the `TrainProfile_<target>` target, which runs the training COMMAND (eg. the instrumented target with a
+##  representative workload) and produces the profile named after the target. The previous contents of the profile are
+##  removed first, so that it only reflects the current sources.
+##
+##      z4ge_pgo_train(<target> COMMAND <command> [<argument>...] [WORKING_DIRECTORY <directory>])
+function(z4ge_pgo_train TARGET)
+    cmake_parse_arguments(TRAIN "" "WORKING_DIRECTORY" "COMMAND" ${ARGN})
+    if(NOT TARGET ${TARGET})
+        message(FATAL_ERROR "[z4ge_pgo_train] ${TARGET} is not a target")
+    endif()
+    get_target_property(INSTRUMENTED ${TARGET} Z4GE_PGO_INSTRUMENTED)
+    if(NOT INSTRUMENTED)
+        message(FATAL_ERROR "[z4ge_pgo_train] ${TARGET} is not instrumented, call z4ge_pgo_instrument(${TARGET}) first")
+    endif()
+    if(NOT TRAIN_COMMAND)
+        message(FATAL_ERROR "[z4ge_pgo_train] COMMAND is required")
+    endif()
+    if(NOT TRAIN_WORKING_DIRECTORY)
+        set(TRAIN_WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})
+    endif()
+    z4ge_pgo_directory(${TARGET} PROFILE_DIRECTORY)
+
+    set(MERGE_COMMAND)
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        z4ge_find_llvm_profdata()
+        set(MERGE_COMMAND
+            COMMAND ${Z4GE_LLVM_PROFDATA} merge -output=${PROFILE_DIRECTORY}/${TARGET}.profdata ${PROFILE_DIRECTORY}/Raw
+        )
+    endif()
+
+    add_custom_target(
+        TrainProfile_${TARGET}
+        COMMAND ${CMAKE_COMMAND} -E remove_directory ${PROFILE_DIRECTORY}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${PROFILE_DIRECTORY}/Raw
+        COMMAND ${TRAIN_COMMAND}
+        ${MERGE_COMMAND}
+        COMMAND ${CMAKE_COMMAND} -E touch ${PROFILE_DIRECTORY}/Profile.stamp
+        WORKING_DIRECTORY ${TRAIN_WORKING_DIRECTORY}
+        COMMENT "Training the profile of ${TARGET} @ ${PROFILE_DIRECTORY}"
+        VERBATIM
+    )
+    add_dependencies(TrainProfile_${TARGET} ${TARGET})
+endfunction()
+
+##  Warns about a profile that is older than one of the sources of the target, which is refreshed by building REFRESH_TARGET
+function(z4ge_check_profile TARGET PROFILE PROFILE_STAMP REFRESH_TARGET)
+    get_target_property(TARGET_SOURCES ${TARGET} SOURCES)
+    get_target_property(TARGET_SOURCE_DIRECTORY ${TARGET} SOURCE_DIR)
+    foreach(SOURCE IN LISTS TARGET_SOURCES)
+        if(SOURCE MATCHES "^\\$<")
+            continue()
+        endif()
+        if(NOT IS_ABSOLUTE ${SOURCE})
+            set(SOURCE ${TARGET_SOURCE_DIRECTORY}/${SOURCE})
+        endif()
+        if(EXISTS ${SOURCE} AND ${SOURCE} IS_NEWER_THAN ${PROFILE_STAMP})
+            message(WARNING "[Z4GEOptimization] The ${PROFILE} profile of ${TARGET} is stale, ${SOURCE} has changed "
+                            "since it was trained. Functions whose code has changed are optimized without profile data, "
+                            "rebuild ${REFRESH_TARGET} to refresh it")
+            return()
+        endif()
+    endforeach()
+endfunction()
+
+##  z4ge_pgo_optimize
+##  Optimizes a target with the PROFILE (the target itself by default) produced by `TrainProfile_<profile>` (`-fprofile-use`
+##  on GCC, `-fprofile-instr-use` on Clang). When there is no profile, a warning is issued and the target is built without
+##  it. A profile older than the sources of the target is still used, with a warning, since the compilers ignore the profile
+##  of the changed functions.
+##
+##      z4ge_pgo_optimize(<target> [PROFILE <profile>])
+function(z4ge_pgo_optimize TARGET)
+    cmake_parse_arguments(PGO "" "PROFILE" "" ${ARGN})
+    if(NOT TARGET ${TARGET})
+        message(FATAL_ERROR "[z4ge_pgo_optimize] ${TARGET} is not a target")
+    endif()
+    if(NOT PGO_PROFILE)
+        set(PGO_PROFILE ${TARGET})
+    endif()
+    z4ge_pgo_directory(${PGO_PROFILE} PROFILE_DIRECTORY)
+    set(PROFILE_STAMP ${PROFILE_DIRECTORY}/Profile.stamp)
+    if(NOT EXISTS ${PROFILE_STAMP})
+        message(WARNING "[z4ge_pgo_optimize] There is no ${PGO_PROFILE} profile in ${PROFILE_DIRECTORY}, build "
+                        "TrainProfile_${PGO_PROFILE} in an instrumented configuration first. ${TARGET} is built without it")
+        return()
+    endif()
+    z4ge_check_profile(${TARGET} ${PGO_PROFILE} ${PROFILE_STAMP} TrainProfile_${PGO_PROFILE})
+
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        ##  A mismatching profile is an error by default on GCC
+        set(PGO_OPTIONS -fprofile-use=${PROFILE_DIRECTORY} -Wno-error=coverage-mismatch)
+        if(NOT CMAKE_CXX_COMPILER_VERSION VERSION_LESS 10.1)
+            ##  Keeps optimizing the code that the training did not reach for speed, rather than for size
+            list(APPEND PGO_OPTIONS -fprofile-partial-training)
+        endif()
+    elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang" AND NOT CMAKE_CXX_COMPILER_FRONTEND_VARIANT STREQUAL "MSVC")
+        set(PGO_OPTIONS -fprofile-instr-use=${PROFILE_DIRECTORY}/${PGO_PROFILE}.profdata)
+    else()
+        message(FATAL_ERROR "[z4ge_pgo_optimize] Profile-guided optimization is not supported for "
+                            "${CMAKE_CXX_COMPILER_ID}")
+    endif()
+
+    target_compile_options(${TARGET} PRIVATE ${PGO_OPTIONS})
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${PROFILE_STAMP})
+    message(STATUS "Z4GE.Configuration    =>  Optimizing ${TARGET} with the ${PGO_PROFILE} profile")
+endfunction()
+
+##  Sample-based Feedback-directed Optimization (AutoFDO)
+##  Unlike instrumented profiles, sample profiles are recorded from the optimized binary with `perf record -b` (branch
+##  records, eg. the LBR of Intel processors), thus they can be collected under realistic load. The binary only needs line
+##  tables and discriminators, which z4ge_autofdo_prepare adds. Both stages are configurations of the same build tree, eg.
+##
+##      if(MY_FDO_STAGE STREQUAL "RECORD")
+##          z4ge_autofdo_prepare(ServerCore)
+##          z4ge_autofdo_record(Server COMMAND Server --replay ${CMAKE_SOURCE_DIR}/Traffic.log)
+##      elseif(MY_FDO_STAGE STREQUAL "OPTIMIZE")
+##          z4ge_autofdo_optimize(Server)
+##          z4ge_autofdo_optimize(ServerCore PROFILE Server)
+##      endif()
+##
+##  followed by building the `SampleProfile_Server` target in the recording configuration. The sample profile is stored in
+##  `<CMAKE_BINARY_DIR>/Profiles/<profile>/Samples`.
+
+##  Debug information that maps the samples back to the source, which has to be identical when recording and optimizing
+function(z4ge_autofdo_debug_options OUTPUT)
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang" AND NOT CMAKE_CXX_COMPILER_FRONTEND_VARIANT STREQUAL "MSVC")
+        set(${OUTPUT} -gline-tables-only -fdebug-info-for-profiling PARENT_SCOPE)
+    elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        set(${OUTPUT} -g1 PARENT_SCOPE)
+    else()
+        message(FATAL_ERROR "[Z4GEOptimization] AutoFDO is not supported for ${CMAKE_CXX_COMPILER_ID}")
+    endif()
+endfunction()
+
+##  z4ge_autofdo_prepare
+##  Compiles a target with the debug information that AutoFDO requires (`-gline-tables-only -fdebug-info-for-profiling` on
+##  Clang, `-g1` on GCC). Targets that are recorded with z4ge_autofdo_record are prepared implicitly, libraries linked into
+##  them have to be prepared explicitly.
+##
+##      z4ge_autofdo_prepare(<target>)
+function(z4ge_autofdo_prepare TARGET)
+    if(NOT TARGET ${TARGET})
+        message(FATAL_ERROR "[z4ge_autofdo_prepare] ${TARGET} is not a target")
+    endif()
+    z4ge_autofdo_debug_options(AUTOFDO_OPTIONS)
+    target_compile_options(${TARGET} PRIVATE ${AUTOFDO_OPTIONS})
+endfunction()
+
+##  z4ge_autofdo_record
+##  Adds the `SampleProfile_<target>` target, which records the COMMAND (eg. the target with a representative workload)
+##  with `perf record -b` and converts the samples into the sample profile named after the target. A `perf.data` recorded
+##  elsewhere from the same binary can be converted instead, with PERF_DATA. The conversion uses `create_llvm_prof` (or
+##  `llvm-profgen`) on Clang and `create_gcov` on GCC, see https://github.com/google/autofdo. Additional `perf record`
+##  options (eg. `-e br_inst_retired.near_taken:u`) are given with PERF_OPTIONS.
+##
+##      z4ge_autofdo_record(<target> COMMAND <command> [<argument>...] [PERF_OPTIONS <option>...]
+##                          [WORKING_DIRECTORY <directory>])
+##      z4ge_autofdo_record(<target> PERF_DATA <file>)
+function(z4ge_autofdo_record TARGET)
+    cmake_parse_arguments(RECORD "" "WORKING_DIRECTORY;PERF_DATA" "COMMAND;PERF_OPTIONS" ${ARGN})
+    if(NOT TARGET ${TARGET})
+        message(FATAL_ERROR "[z4ge_autofdo_record] ${TARGET} is not a target")
+    endif()
+    if(NOT RECORD_COMMAND AND NOT RECORD_PERF_DATA)
+        message(FATAL_ERROR "[z4ge_autofdo_record] Either COMMAND or PERF_DATA is required")
+    endif()
+    if(RECORD_COMMAND AND RECORD_PERF_DATA)
+        message(FATAL_ERROR "[z4ge_autofdo_record] COMMAND and PERF_DATA are mutually exclusive")
+    endif()
+    if(NOT RECORD_WORKING_DIRECTORY)
+        set(RECORD_WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})
+    endif()
+    z4ge_autofdo_prepare(${TARGET})
+    z4ge_pgo_directory(${TARGET} PROFILE_DIRECTORY)
+    set(SAMPLES_DIRECTORY ${PROFILE_DIRECTORY}/Samples)
+    set(SAMPLE_PROFILE ${SAMPLES_DIRECTORY}/${TARGET}.afdo)
+
+    set(RECORD_COMMANDS)
+    if(RECORD_COMMAND)
+        find_program(Z4GE_PERF perf)
+        if(NOT Z4GE_PERF)
+            message(FATAL_ERROR "[z4ge_autofdo_record] Unable to find perf, set Z4GE_PERF")
+        endif()
+        set(RECORD_PERF_DATA ${SAMPLES_DIRECTORY}/perf.data)
+        ##  The command is an argument of perf, thus CMake does not replace a target name with its file
+        list(GET RECORD_COMMAND 0 RECORD_EXECUTABLE)
+        if(TARGET ${RECORD_EXECUTABLE})
+            list(REMOVE_AT RECORD_COMMAND 0)
+            list(INSERT RECORD_COMMAND 0 $<TARGET_FILE:${RECORD_EXECUTABLE}>)
+        endif()
+        set(RECORD_COMMANDS
+            COMMAND ${Z4GE_PERF} record -b ${RECORD_PERF_OPTIONS} -o ${RECORD_PERF_DATA} -- ${RECORD_COMMAND}
+        )
+    endif()
+
+    get_filename_component(COMPILER_DIRECTORY ${CMAKE_CXX_COMPILER} DIRECTORY)
+    string(REGEX MATCH "^[0-9]+" COMPILER_MAJOR_VERSION "${CMAKE_CXX_COMPILER_VERSION}")
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        find_program(Z4GE_CREATE_LLVM_PROF create_llvm_prof)
+        find_program(Z4GE_LLVM_PROFGEN NAMES llvm-profgen-${COMPILER_MAJOR_VERSION} llvm-profgen HINTS ${COMPILER_DIRECTORY})
+        if(Z4GE_CREATE_LLVM_PROF)
+            set(CONVERT_COMMAND
+                ${Z4GE_CREATE_LLVM_PROF} --binary=$<TARGET_FILE:${TARGET}> --profile=${RECORD_PERF_DATA}
+                --out=${SAMPLE_PROFILE}
+            )
+        elseif(Z4GE_LLVM_PROFGEN)
+            set(CONVERT_COMMAND
+                ${Z4GE_LLVM_PROFGEN} --binary=$<TARGET_FILE:${TARGET}> --perfdata=${RECORD_PERF_DATA}
+                --output=${SAMPLE_PROFILE}
+            )
+        else()
+            message(FATAL_ERROR "[z4ge_autofdo_record] Unable to find create_llvm_prof or llvm-profgen, set "
+                                "Z4GE_CREATE_LLVM_PROF or Z4GE_LLVM_PROFGEN")
+        endif()
+    elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        find_program(Z4GE_CREATE_GCOV create_gcov)
+        if(NOT Z4GE_CREATE_GCOV)
+            message(FATAL_ERROR "[z4ge_autofdo_record] Unable to find create_gcov, set Z4GE_CREATE_GCOV")
+        endif()
+        set(CONVERT_COMMAND
+            ${Z4GE_CREATE_GCOV} --binary=$<TARGET_FILE:${TARGET}> --profile=${RECORD_PERF_DATA} --gcov=${SAMPLE_PROFILE}
+            --gcov_version=1
+        )
+    else()
+        message(FATAL_ERROR "[z4ge_autofdo_record] AutoFDO is not supported for ${CMAKE_CXX_COMPILER_ID}")
+    endif()
+
+    add_custom_target(
+        SampleProfile_${TARGET}
+        COMMAND ${CMAKE_COMMAND} -E remove_directory ${SAMPLES_DIRECTORY}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${SAMPLES_DIRECTORY}
+        ${RECORD_COMMANDS}
+        COMMAND ${CONVERT_COMMAND}
+        COMMAND ${CMAKE_COMMAND} -E touch ${SAMPLES_DIRECTORY}/Profile.stamp
+        WORKING_DIRECTORY ${RECORD_WORKING_DIRECTORY}
+        COMMENT "Recording the sample profile of ${TARGET} @ ${SAMPLES_DIRECTORY}"
+        VERBATIM
+    )
+    add_dependencies(SampleProfile_${TARGET} ${TARGET})
+endfunction()
+
+##  z4ge_autofdo_optimize
+##  Optimizes a target with the sample PROFILE (the target itself by default) produced by `SampleProfile_<profile>`
+##  (`-fprofile-sample-use` on Clang, `-fauto-profile` on GCC). A missing or stale profile is handled as in
+##  z4ge_pgo_optimize.
+##
+##      z4ge_autofdo_optimize(<target> [PROFILE <profile>])
+function(z4ge_autofdo_optimize TARGET)
+    cmake_parse_arguments(FDO "" "PROFILE" "" ${ARGN})
+    if(NOT TARGET ${TARGET})
+        message(FATAL_ERROR "[z4ge_autofdo_optimize] ${TARGET} is not a target")
+    endif()
+    if(NOT FDO_PROFILE)
+        set(FDO_PROFILE ${TARGET})
+    endif()
+    z4ge_pgo_directory(${FDO_PROFILE} PROFILE_DIRECTORY)
+    set(SAMPLE_PROFILE ${PROFILE_DIRECTORY}/Samples/${FDO_PROFILE}.afdo)
+    set(PROFILE_STAMP ${PROFILE_DIRECTORY}/Samples/Profile.stamp)
+    if(NOT EXISTS ${PROFILE_STAMP})
+        message(WARNING "[z4ge_autofdo_optimize] There is no ${FDO_PROFILE} sample profile in ${PROFILE_DIRECTORY}/Samples, "
+                        "build SampleProfile_${FDO_PROFILE} in a recording configuration first. ${TARGET} is built "
+                        "without it")
+        return()
+    endif()
+    z4ge_check_profile(${TARGET} ${FDO_PROFILE} ${PROFILE_STAMP} SampleProfile_${FDO_PROFILE})
+
+    z4ge_autofdo_debug_options(FDO_OPTIONS)
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        list(APPEND FDO_OPTIONS -fauto-profile=${SAMPLE_PROFILE})
+    else()
+        list(APPEND FDO_OPTIONS -fprofile-sample-use=${SAMPLE_PROFILE})
+    endif()
+
+    target_compile_options(${TARGET} PRIVATE ${FDO_OPTIONS})
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${PROFILE_STAMP})
+    message(STATUS "Z4GE.Configuration    =>  Optimizing ${TARGET} with the ${FDO_PROFILE} sample profile")
+endfunction()
@@ -0,0 +1,170 @@
+##  Z4GE.Configuration
+##  Copyright 2022 DeathBlizzard
+##  
+##  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+##  conditions are met:
+##  
+##  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+##      disclaimer.Configuration
+##  
+##  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+##      disclaimer in the documentation and/or other materials provided with the distribution.
+##  
+##  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+##      derived from this software without specific prior written permission.
+##  
+##  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+##  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+##  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+##  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+##  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+##  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+##  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+##  Module Guard
+##  Prevent `Z4GEResolveConfiguration` module to be included more than once by the parent CMakeLists.txt
+if(DEFINED Z4GE_RESOLVE_CONFIGURATION_INCLUDED)
+    return()
+endif()
+set(Z4GE_RESOLVE_CONFIGURATION_INCLUDED YES)
+
+set(Z4GE_RESOLVE_CONFIGURATION_TEMPLATE ${CMAKE_CURRENT_LIST_DIR}/Z4GEResolvedConfiguration.hh.in)
+
+##  z4ge_resolve_configuration
+##  Resolves every macro defined by `Z4GE/Configuration/CompilerTraits.hh`, `Platform.hh` and `Macros.hh` for the active
+##  toolchain, once, and writes them as a flat list of definitions to `<OUTPUT_DIRECTORY>/Z4GE/Configuration/Resolved.hh`.
+##  Translation units that include `Resolved.hh` first skip the nested `#if` chains of these headers, since their include
+##  guards are part of the resolved definitions. Including `Z4GE/Configuration.hh` or any other Z4GE header afterwards only
+##  processes the declarations of that header.
+##
+##  The macros are resolved by running the preprocessor of the C++ compiler with `-dM`, using the CMAKE_CXX_FLAGS of the
+##  build type, the CMAKE_CXX_STANDARD and the given DEFINITIONS and OPTIONS. Targets including the generated header must be
+##  compiled with the same language standard, instruction set and Z4GE_* definitions. The header verifies the toolchain, the
+##  instruction set macros of the compiler and the Z4GE_FORCE_* definitions, so it cannot be used by the targets of
+##  `z4ge_target_isa` that select another instruction set than the build.
+##  Compilers without a GCC compatible preprocessor (eg. Microsoft Visual C++) get a header that includes
+##  `Z4GE/Configuration/CompilerTraits.hh` instead.
+##
+##      z4ge_resolve_configuration(
+##          OUTPUT_DIRECTORY <directory>
+##          [DEFINITIONS <definition>...]
+##          [OPTIONS <option>...]
+##      )
+function(z4ge_resolve_configuration)
+    cmake_parse_arguments(RESOLVE "" "OUTPUT_DIRECTORY" "DEFINITIONS;OPTIONS" ${ARGN})
+    if(NOT RESOLVE_OUTPUT_DIRECTORY)
+        message(FATAL_ERROR "[z4ge_resolve_configuration] OUTPUT_DIRECTORY is required")
+    endif()
+
+    set(RESOLVED_HEADER ${RESOLVE_OUTPUT_DIRECTORY}/Z4GE/Configuration/Resolved.hh)
+    set(Z4GE_RESOLVED_DEFINITIONS "#include <Z4GE/Configuration/CompilerTraits.hh>")
+    set(Z4GE_RESOLVED_CHECKS "")
+
+    ##  Reconfigure whenever one of the resolved headers changes
+    file(GLOB RESOLVED_SOURCES ${Z4GE_CONFIGURATION_INCLUDE_DIRECTORY}/Z4GE/Configuration/*.hh)
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${RESOLVED_SOURCES} ${Z4GE_RESOLVE_CONFIGURATION_TEMPLATE})
+
+    if(CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang|IntelLLVM" AND NOT CMAKE_CXX_COMPILER_FRONTEND_VARIANT STREQUAL "MSVC")
+        ##  Compiler flags of the active configuration
+        set(RESOLVE_FLAGS ${CMAKE_CXX_FLAGS})
+        if(CMAKE_BUILD_TYPE)
+            string(TOUPPER ${CMAKE_BUILD_TYPE} RESOLVE_BUILD_TYPE)
+            string(APPEND RESOLVE_FLAGS " ${CMAKE_CXX_FLAGS_${RESOLVE_BUILD_TYPE}}")
+        endif()
+        separate_arguments(RESOLVE_FLAGS NATIVE_COMMAND "${RESOLVE_FLAGS}")
+        if(CMAKE_CXX_STANDARD)
+            if(CMAKE_CXX_EXTENSIONS OR NOT DEFINED CMAKE_CXX_EXTENSIONS)
+                list(APPEND RESOLVE_FLAGS ${CMAKE_CXX${CMAKE_CXX_STANDARD}_EXTENSION_COMPILE_OPTION})
+            else()
+                list(APPEND RESOLVE_FLAGS ${CMAKE_CXX${CMAKE_CXX_STANDARD}_STANDARD_COMPILE_OPTION})
+            endif()
+        endif()
+        foreach(DEFINITION IN LISTS RESOLVE_DEFINITIONS)
+            list(APPEND RESOLVE_FLAGS -D${DEFINITION})
+        endforeach()
+        list(APPEND RESOLVE_FLAGS ${RESOLVE_OPTIONS})
+
+        set(RESOLVE_SOURCE ${CMAKE_CURRENT_BINARY_DIR}/Z4GEResolveConfiguration.cc)
+        file(WRITE ${RESOLVE_SOURCE} "#include <Z4GE/Configuration/CompilerTraits.hh>\n")
+        execute_process(
+            COMMAND ${CMAKE_CXX_COMPILER} ${RESOLVE_FLAGS} -I${Z4GE_CONFIGURATION_INCLUDE_DIRECTORY} -dM -E ${RESOLVE_SOURCE}
+            RESULT_VARIABLE RESOLVE_RESULT
+            OUTPUT_VARIABLE RESOLVE_OUTPUT
+            ERROR_VARIABLE  RESOLVE_ERROR
+        )
+        if(NOT RESOLVE_RESULT EQUAL 0)
+            message(FATAL_ERROR "[z4ge_resolve_configuration] Unable to preprocess CompilerTraits.hh\n${RESOLVE_ERROR}")
+        endif()
+
+        ##  Keep the Z4GE_* definitions, line by line. The output is not split into a CMake list since the definitions contain
+        ##  semicolons and brackets. The definitions of the header that CompilerTraits.hh includes at its end are left out, so
+        ##  that this header is still processed by Resolved.hh
+        set(EXCLUDED_DEFINITIONS "Z4GE_CONFIGURATION__BRANCH_AUDIT_HH_|Z4GE_BRANCH_AUDIT_")
+        set(CHECKED_DEFINITIONS "__cplusplus|__SIZEOF_POINTER__|__GNUC__|__GNUC_MINOR__|__clang_major__|__clang_minor__")
+
+        ##  Z4GE_ARCHITECTURE is resolved from the instruction set macros of the compiler and the Z4GE_FORCE_* definitions,
+        ##  which differ between targets (eg. through z4ge_target_isa). The header refuses to be included unless each of
+        ##  them is defined exactly as it was when resolving
+        set(ARCHITECTURE_DEFINITIONS
+            __i386__ __x86_64__ __arm__ __aarch64__ __ARM_ARCH __ARM_NEON __ARM_NEON__
+            __SSE__ __SSE2__ __SSE3__ __SSSE3__ __SSE4_1__ __SSE4_2__ __AVX__ __AVX2__
+            __POPCNT__ __LZCNT__ __BMI__ __BMI2__ __F16C__ __FMA__
+            __AVX512F__ __AVX512CD__ __AVX512BW__ __AVX512DQ__ __AVX512VL__ __AVX512VNNI__
+            Z4GE_FORCE_INTRINSICS Z4GE_FORCE_X86_INTRINSICS Z4GE_FORCE_SSE_INTRINSICS Z4GE_FORCE_SSE2_INTRINSICS
+            Z4GE_FORCE_SSE3_INTRINSICS Z4GE_FORCE_SSSE3_INTRINSICS Z4GE_FORCE_SSE41_INTRINSICS Z4GE_FORCE_SSE42_INTRINSICS
+            Z4GE_FORCE_AVX_INTRINSICS Z4GE_FORCE_AVX2_INTRINSICS Z4GE_FORCE_AVX512VNNI_INTRINSICS
+            Z4GE_FORCE_X86_64_V2_INTRINSICS Z4GE_FORCE_X86_64_V3_INTRINSICS Z4GE_FORCE_X86_64_V4_INTRINSICS
+            Z4GE_FORCE_ARM_INTRINSICS Z4GE_FORCE_NEON_INTRINSICS Z4GE_FORCE_ARMV8_INTRINSICS
+            Z4GE_FORCE_UNKNOWN_ARCHITECTURE Z4GE_NO_SIMD_INTRINSICS
+        )
+        list(JOIN ARCHITECTURE_DEFINITIONS "|" ARCHITECTURE_PATTERN)
+        set(DEFINED_ARCHITECTURE_DEFINITIONS)
+
+        set(RESOLVED "")
+        set(RESOLVED_COUNT 0)
+        string(APPEND RESOLVE_OUTPUT "\n")
+        string(FIND "${RESOLVE_OUTPUT}" "\n" LINE_END)
+        while(NOT LINE_END EQUAL -1)
+            string(SUBSTRING "${RESOLVE_OUTPUT}" 0 ${LINE_END} LINE)
+            math(EXPR LINE_END "${LINE_END} + 1")
+            string(SUBSTRING "${RESOLVE_OUTPUT}" ${LINE_END} -1 RESOLVE_OUTPUT)
+
+            if(LINE MATCHES "^#define (${ARCHITECTURE_PATTERN})( |$)")
+                list(APPEND DEFINED_ARCHITECTURE_DEFINITIONS ${CMAKE_MATCH_1})
+            elseif(LINE MATCHES "^#define Z4GE_" AND NOT LINE MATCHES "^#define (${EXCLUDED_DEFINITIONS})")
+                string(APPEND RESOLVED "${LINE}\n")
+                math(EXPR RESOLVED_COUNT "${RESOLVED_COUNT} + 1")
+            elseif(LINE MATCHES "^#define (${CHECKED_DEFINITIONS}) (.+)$")
+                string(APPEND Z4GE_RESOLVED_CHECKS
+                    "#if !defined(${CMAKE_MATCH_1}) || ${CMAKE_MATCH_1} != ${CMAKE_MATCH_2}\n"
+                    "#    error \"Z4GE/Configuration/Resolved.hh was generated for another toolchain (${CMAKE_MATCH_1})\"\n"
+                    "#endif\n"
+                )
+            endif()
+            string(FIND "${RESOLVE_OUTPUT}" "\n" LINE_END)
+        endwhile()
+
+        foreach(DEFINITION IN LISTS ARCHITECTURE_DEFINITIONS)
+            if(DEFINITION IN_LIST DEFINED_ARCHITECTURE_DEFINITIONS)
+                set(CONDITION "!defined(${DEFINITION})")
+                set(REASON "with ${DEFINITION}")
+            else()
+                set(CONDITION "defined(${DEFINITION})")
+                set(REASON "without ${DEFINITION}")
+            endif()
+            string(APPEND Z4GE_RESOLVED_CHECKS
+                "#if ${CONDITION}\n"
+                "#    error \"Z4GE/Configuration/Resolved.hh was generated ${REASON}, include Z4GE/Configuration.hh instead\"\n"
+                "#endif\n"
+            )
+        endforeach()
+
+        set(Z4GE_RESOLVED_DEFINITIONS "${RESOLVED}")
+        message(STATUS "Z4GE.Configuration    =>  Resolved ${RESOLVED_COUNT} definitions into ${RESOLVED_HEADER}")
+    else()
+        message(STATUS "Z4GE.Configuration    =>  Unable to resolve definitions with ${CMAKE_CXX_COMPILER_ID}, "
+                       "${RESOLVED_HEADER} includes Z4GE/Configuration/CompilerTraits.hh")
+    endif()
+
+    configure_file(${Z4GE_RESOLVE_CONFIGURATION_TEMPLATE} ${RESOLVED_HEADER} @ONLY)
+endfunction()
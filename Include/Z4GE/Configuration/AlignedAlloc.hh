@@ -0,0 +1,258 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__ALIGNED_ALLOC_HH_
+#define Z4GE_CONFIGURATION__ALIGNED_ALLOC_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/AlignedAlloc.hh
+/// @brief      Aligned and over-aligned memory allocation
+/// @details    This header provides @ref Z4GE::AlignedAlloc, @ref Z4GE::AlignedFree and the standard library compatible
+///             @ref Z4GE::AlignedAllocator, which allocate memory with an alignment stricter than that of `malloc` (eg.
+///             32 / 64 byte aligned SIMD buffers) without over-allocating and rounding the pointer by hand.
+///
+///             The allocation is delegated to, in order of preference
+///                 -#  `_aligned_malloc` / `_aligned_free` on Microsoft Windows
+///                 -#  `posix_memalign` / `free` on Linux, Android, MacOS and other UNIXes
+///                 -#  The CXX 17 aligned `operator new` / `operator delete` ( @ref Z4GE_HAS_ALIGNED_NEW is set )
+///                 -#  Over-allocation through `std::malloc`, storing the original pointer in front of the aligned block
+///
+/// @par        Debug Mode
+///             When @ref Z4GE_ALIGNED_ALLOC_DEBUG is set (by default, unless `NDEBUG` is defined), the alignment of every
+///             allocated block and of every pointer passed to @ref Z4GE::AlignedFree is verified, and the process is aborted
+///             with a diagnostic on a mismatch.
+/// @note       Unlike the other Z4GE.Configuration headers, this header is not included by @ref Z4GE/Configuration.hh
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+#if Z4GE_PLATFORM & Z4GE_PLATFORM_WINDOWS
+#    include <malloc.h>
+#    define Z4GE_ALIGNED_ALLOC_WINDOWS Z4GE_ENABLE
+#    define Z4GE_ALIGNED_ALLOC_POSIX Z4GE_DISABLE
+#elif Z4GE_PLATFORM != Z4GE_PLATFORM_UNKNOWN
+#    include <stdlib.h>
+#    define Z4GE_ALIGNED_ALLOC_WINDOWS Z4GE_DISABLE
+#    define Z4GE_ALIGNED_ALLOC_POSIX Z4GE_ENABLE
+#else
+#    define Z4GE_ALIGNED_ALLOC_WINDOWS Z4GE_DISABLE
+#    define Z4GE_ALIGNED_ALLOC_POSIX Z4GE_DISABLE
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the alignment of aligned allocations is verified
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_ALIGNED_ALLOC_DEBUG
+#    if defined(NDEBUG)
+#        define Z4GE_ALIGNED_ALLOC_DEBUG Z4GE_DISABLE
+#    else
+#        define Z4GE_ALIGNED_ALLOC_DEBUG Z4GE_ENABLE
+#    endif
+#endif
+
+namespace Z4GE {
+
+    namespace Detail {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Whether @p Alignment is a non-zero power of two
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline Z4GE_CONSTEXPR bool IsValidAlignment (std::size_t Alignment) Z4GE_NOEXCEPT {
+            return Alignment != 0 && (Alignment & (Alignment - 1)) == 0;
+        }
+
+        inline bool IsAligned (const void* Pointer, std::size_t Alignment) Z4GE_NOEXCEPT {
+            return (reinterpret_cast<std::uintptr_t> (Pointer) & (Alignment - 1)) == 0;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Aborts the process if @p Pointer is not aligned to @p Alignment
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline void VerifyAlignment (const void* Pointer, std::size_t Alignment, const char* Operation) Z4GE_NOEXCEPT {
+            if (Z4GE_UNLIKELY (!IsAligned (Pointer, Alignment))) {
+                std::fprintf (stderr,
+                              "Z4GE: %s: pointer %p is not aligned to %llu bytes\n",
+                              Operation,
+                              Pointer,
+                              static_cast<unsigned long long> (Alignment));
+                std::abort ();
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      The alignment actually requested from the underlying allocator
+        /// @details    `posix_memalign` requires a multiple of `sizeof (void*)`
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline Z4GE_CONSTEXPR std::size_t EffectiveAlignment (std::size_t Alignment) Z4GE_NOEXCEPT {
+            return Alignment < sizeof (void*) ? sizeof (void*) : Alignment;
+        }
+
+    } // namespace Detail
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Allocates @p Size bytes aligned to @p Alignment
+    /// @param[in]  Size        Number of bytes. A zero @p Size allocates a unique block of a single byte
+    /// @param[in]  Alignment   The alignment, in bytes. Must be a power of two
+    /// @returns    The aligned block, `nullptr` if the allocation failed or @p Alignment is not a power of two. The block
+    ///             must be released with @ref Z4GE::AlignedFree using the same @p Alignment
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline void* AlignedAlloc (std::size_t Size, std::size_t Alignment) Z4GE_NOEXCEPT {
+        if (!Detail::IsValidAlignment (Alignment)) {
+            return nullptr;
+        }
+        Alignment = Detail::EffectiveAlignment (Alignment);
+        Size      = Size ? Size : 1;
+
+#if Z4GE_ALIGNED_ALLOC_WINDOWS
+        void* Pointer = _aligned_malloc (Size, Alignment);
+#elif Z4GE_ALIGNED_ALLOC_POSIX
+        void* Pointer = nullptr;
+        if (posix_memalign (&Pointer, Alignment, Size) != 0) {
+            Pointer = nullptr;
+        }
+#elif Z4GE_HAS_ALIGNED_NEW
+        void* Pointer = ::operator new (Size, std::align_val_t (Alignment), std::nothrow);
+#else
+        //  Over-allocate and store the pointer returned by malloc right in front of the aligned block
+        if (Size > std::numeric_limits<std::size_t>::max () - Alignment - sizeof (void*)) {
+            return nullptr;
+        }
+        void* Pointer = nullptr;
+        if (void* Block = std::malloc (Size + Alignment + sizeof (void*))) {
+            const std::uintptr_t Address = reinterpret_cast<std::uintptr_t> (Block) + sizeof (void*);
+            Pointer                      = reinterpret_cast<void*> ((Address + Alignment - 1) & ~(Alignment - 1));
+            static_cast<void**> (Pointer)[-1] = Block;
+        }
+#endif
+
+#if Z4GE_ALIGNED_ALLOC_DEBUG
+        if (Pointer) {
+            Detail::VerifyAlignment (Pointer, Alignment, "AlignedAlloc");
+        }
+#endif
+        return Pointer;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Releases a block allocated by @ref Z4GE::AlignedAlloc
+    /// @param[in]  Pointer     The block. `nullptr` is ignored
+    /// @param[in]  Alignment   The alignment the block was allocated with
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline void AlignedFree (void* Pointer, std::size_t Alignment) Z4GE_NOEXCEPT {
+        if (!Pointer) {
+            return;
+        }
+        Alignment = Detail::EffectiveAlignment (Alignment);
+
+#if Z4GE_ALIGNED_ALLOC_DEBUG
+        Detail::VerifyAlignment (Pointer, Alignment, "AlignedFree");
+#endif
+
+#if Z4GE_ALIGNED_ALLOC_WINDOWS
+        _aligned_free (Pointer);
+#elif Z4GE_ALIGNED_ALLOC_POSIX
+        free (Pointer);
+#elif Z4GE_HAS_ALIGNED_NEW
+        ::operator delete (Pointer, std::align_val_t (Alignment));
+#else
+        std::free (static_cast<void**> (Pointer)[-1]);
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Standard library compatible allocator returning storage aligned to @p Alignment
+    /// @details    @code
+    ///                 std::vector<float, Z4GE::AlignedAllocator<float, 32>> Samples (Count);
+    ///                 Z4GE::Simd::Float32x8::LoadAligned (Samples.data ());
+    ///             @endcode
+    ///
+    ///             Rebinding keeps @p Alignment, so that `rebind<U>::other::rebind<T>::other` is the original allocator. A
+    ///             type whose own alignment is stricter than @p Alignment (eg. the node of a node based container) is
+    ///             allocated with its own alignment instead. Allocators of different alignments neither convert into each
+    ///             other nor compare equal.
+    /// @tparam     T           The allocated type
+    /// @tparam     Alignment   The alignment, in bytes. A power of two
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t Alignment = Z4GE_ALIGN_OF (T)>
+    class AlignedAllocator {
+        //  The alignment of the blocks, which allocate and deallocate have to agree on
+        static Z4GE_CONSTEXPR std::size_t StorageAlignment (void) Z4GE_NOEXCEPT {
+            return Alignment > Z4GE_ALIGN_OF (T) ? Alignment : Z4GE_ALIGN_OF (T);
+        }
+
+    public:
+        Z4GE_STATIC_ASSERT (Detail::IsValidAlignment (Alignment), "Alignment must be a power of two");
+
+        typedef T           value_type;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template<typename U>
+        struct rebind {
+            typedef AlignedAllocator<U, Alignment> other;
+        };
+
+        AlignedAllocator (void) Z4GE_NOEXCEPT {}
+
+        //  Only allocators of the same alignment convert, since those of another alignment do not compare equal
+        template<typename U>
+        AlignedAllocator (const AlignedAllocator<U, Alignment>&) Z4GE_NOEXCEPT {}
+
+        T* allocate (std::size_t Count) {
+            if (Count > std::numeric_limits<std::size_t>::max () / sizeof (T)) {
+                throw std::bad_alloc ();
+            }
+            void* Pointer = AlignedAlloc (Count * sizeof (T), StorageAlignment ());
+            if (!Pointer) {
+                throw std::bad_alloc ();
+            }
+            return static_cast<T*> (Pointer);
+        }
+
+        void deallocate (T* Pointer, std::size_t) Z4GE_NOEXCEPT { AlignedFree (Pointer, StorageAlignment ()); }
+
+        template<typename U, std::size_t OtherAlignment>
+        bool operator== (const AlignedAllocator<U, OtherAlignment>&) const Z4GE_NOEXCEPT {
+            return Alignment == OtherAlignment;
+        }
+
+        template<typename U, std::size_t OtherAlignment>
+        bool operator!= (const AlignedAllocator<U, OtherAlignment>&) const Z4GE_NOEXCEPT {
+            return Alignment != OtherAlignment;
+        }
+    };
+
+} // namespace Z4GE
+
+/// @}
+
+#endif
@@ -0,0 +1,183 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__ARCHITECTURE_GUARD_HH_
+#define Z4GE_CONFIGURATION__ARCHITECTURE_GUARD_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/ArchitectureGuard.hh
+/// @brief      Startup Architecture Guard
+/// @details    A program compiled for an instruction set that the executing processor lacks crashes with an illegal
+///             instruction wherever the compiler first used it, often deep inside a hot loop. When
+///             @ref Z4GE_CONFIGURATION_ARCHITECTURE_GUARD is set, this header defines a static object that compares
+///             @ref Z4GE_ARCHITECTURE_GUARD_REQUIRED against @ref Z4GE::Configuration::GetRuntimeArchitecture
+///             "GetRuntimeArchitecture" before the other static objects are constructed (`init_priority (101)` on GCC and
+///             Clang, `init_seg (lib)` on Microsoft Visual C++), and aborts with the names of the missing features, eg.
+///             @code
+///                 Z4GE.Configuration: this processor lacks AVX2 BMI2 FMA, which the program was compiled for
+///             @endcode
+///
+///             The guard itself has to be compiled for the baseline of the target processor, otherwise it may execute the
+///             very instructions it checks for. `z4ge_target_isa (<target> LEVEL <level> GUARD)` (see
+///             CMake/Z4GEArchitecture.cmake) does so, by adding a translation unit that defines the guard and is compiled
+///             for the baseline, and should be preferred to enabling the guard by hand. Every function on the path of the
+///             guard is instantiated for a tag type of internal linkage, so the linker cannot replace them with copies
+///             compiled for a higher level by other translation units.
+/// @note       Unlike the other Z4GE.Configuration headers, this header is not included by @ref Z4GE/Configuration.hh since
+///             it depends on @ref Z4GE/Configuration/RuntimeArchitecture.hh.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+#include <Z4GE/Configuration/RuntimeArchitecture.hh>
+
+#include <cstdio>
+#include <cstdlib>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Enables the startup architecture guard of the including translation unit
+/// @details    The guard should be enabled in a single translation unit of each executable or shared library.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CONFIGURATION_ARCHITECTURE_GUARD
+#    define Z4GE_CONFIGURATION_ARCHITECTURE_GUARD Z4GE_DISABLE
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      The `Z4GE_ARCHITECTURE_BIT_*` flags checked by the startup architecture guard
+/// @details    Defaults to @ref Z4GE_ARCHITECTURE. A guard that is compiled for the baseline has to be given the architecture
+///             of the rest of the program explicitly.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_ARCHITECTURE_GUARD_REQUIRED
+#    define Z4GE_ARCHITECTURE_GUARD_REQUIRED Z4GE_ARCHITECTURE
+#endif
+
+namespace Z4GE { namespace Configuration {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Get the name of a `Z4GE_ARCHITECTURE_BIT_*` flag
+    /// @param[in]  Bit     A single `Z4GE_ARCHITECTURE_BIT_*` flag
+    /// @returns    The name of the feature, eg. `"AVX2"`, or `nullptr` if @p Bit is not a single known flag
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename Tag = void>
+    inline const char* GetArchitectureFeatureName (ArchitectureMask Bit) Z4GE_NOEXCEPT {
+        switch (Bit) {
+            case Z4GE_ARCHITECTURE_BIT_X86: return "x86";
+            case Z4GE_ARCHITECTURE_BIT_SSE: return "SSE";
+            case Z4GE_ARCHITECTURE_BIT_SSE2: return "SSE2";
+            case Z4GE_ARCHITECTURE_BIT_SSE3: return "SSE3";
+            case Z4GE_ARCHITECTURE_BIT_SSSE3: return "SSSE3";
+            case Z4GE_ARCHITECTURE_BIT_SSE41: return "SSE4.1";
+            case Z4GE_ARCHITECTURE_BIT_SSE42: return "SSE4.2";
+            case Z4GE_ARCHITECTURE_BIT_AVX: return "AVX";
+            case Z4GE_ARCHITECTURE_BIT_AVX2: return "AVX2";
+            case Z4GE_ARCHITECTURE_BIT_ARM: return "ARM";
+            case Z4GE_ARCHITECTURE_BIT_NEON: return "NEON";
+            case Z4GE_ARCHITECTURE_BIT_ARMV8: return "ARMv8";
+            case Z4GE_ARCHITECTURE_BIT_POPCNT: return "POPCNT";
+            case Z4GE_ARCHITECTURE_BIT_LZCNT: return "LZCNT";
+            case Z4GE_ARCHITECTURE_BIT_BMI1: return "BMI1";
+            case Z4GE_ARCHITECTURE_BIT_BMI2: return "BMI2";
+            case Z4GE_ARCHITECTURE_BIT_F16C: return "F16C";
+            case Z4GE_ARCHITECTURE_BIT_FMA: return "FMA";
+            case Z4GE_ARCHITECTURE_BIT_AVX512F: return "AVX512F";
+            case Z4GE_ARCHITECTURE_BIT_AVX512CD: return "AVX512CD";
+            case Z4GE_ARCHITECTURE_BIT_AVX512BW: return "AVX512BW";
+            case Z4GE_ARCHITECTURE_BIT_AVX512DQ: return "AVX512DQ";
+            case Z4GE_ARCHITECTURE_BIT_AVX512VL: return "AVX512VL";
+            case Z4GE_ARCHITECTURE_BIT_AVX512VNNI: return "AVX512VNNI";
+            default: return nullptr;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Get the features of @p Required that the executing processor lacks
+    /// @param[in]  Required    A combination of `Z4GE_ARCHITECTURE_BIT_*` flags, eg. @ref Z4GE_ARCHITECTURE
+    /// @returns    The `Z4GE_ARCHITECTURE_BIT_*` flags of @p Required that are not supported, `0` if none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline ArchitectureMask GetMissingArchitecture (ArchitectureMask Required) Z4GE_NOEXCEPT {
+        return Required & ~GetRuntimeArchitecture ();
+    }
+
+    namespace Detail {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Aborts the program, naming the missing features, unless the processor supports @p Required
+        /// @details    The processor is queried without the cache of @ref GetRuntimeArchitecture, whose code may be shared with
+        ///             the translation units compiled for a higher level.
+        /// @tparam     Tag     A type of internal linkage, see @ref DetectRuntimeArchitecture
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename Tag>
+        inline void CheckArchitecture (ArchitectureMask Required) Z4GE_NOEXCEPT {
+            const ArchitectureMask Missing = Required & ~DetectRuntimeArchitecture<Tag> ();
+            if (Z4GE_UNAUDITED_LIKELY (Missing == 0)) {
+                return;
+            }
+
+            std::fputs ("Z4GE.Configuration: this processor lacks", stderr);
+            for (ArchitectureMask Bit = 1; Bit != 0; Bit <<= 1) {
+                if (Missing & Bit) {
+                    const char* Name = GetArchitectureFeatureName<Tag> (Bit);
+                    if (Name != nullptr) {
+                        std::fprintf (stderr, " %s", Name);
+                    } else {
+                        std::fprintf (stderr, " 0x%lx", static_cast<unsigned long> (Bit));
+                    }
+                }
+            }
+            std::fputs (", which the program was compiled for\n", stderr);
+            std::abort ();
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Checks @ref Z4GE_ARCHITECTURE_GUARD_REQUIRED on construction
+        /// @tparam     Tag     A type of internal linkage, see @ref DetectRuntimeArchitecture
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename Tag>
+        struct ArchitectureGuard {
+            ArchitectureGuard () Z4GE_NOEXCEPT { CheckArchitecture<Tag> (Z4GE_ARCHITECTURE_GUARD_REQUIRED); }
+        };
+
+    } // namespace Detail
+
+}} // namespace Z4GE::Configuration
+
+#if Z4GE_CONFIGURATION_ARCHITECTURE_GUARD
+namespace {
+    struct Z4GE_ArchitectureGuardTag {};
+    typedef Z4GE::Configuration::Detail::ArchitectureGuard<Z4GE_ArchitectureGuardTag> Z4GE_ArchitectureGuardType;
+} // namespace
+#    if Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+#        pragma init_seg(lib)
+static const Z4GE_ArchitectureGuardType Z4GE_ArchitectureGuard;
+#    elif Z4GE_PLATFORM & Z4GE_PLATFORM_MACOS
+//  Mach-O does not support initialization priorities, static objects of the other translation units may be constructed first
+static const Z4GE_ArchitectureGuardType Z4GE_ArchitectureGuard;
+#    else
+static const Z4GE_ArchitectureGuardType Z4GE_ArchitectureGuard __attribute__ ((init_priority (101)));
+#    endif
+#endif
+
+/// @}
+
+#endif
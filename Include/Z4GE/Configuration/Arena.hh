@@ -0,0 +1,298 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__ARENA_HH_
+#define Z4GE_CONFIGURATION__ARENA_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/Arena.hh
+/// @brief      Monotonic (bump-pointer) arena and frame allocator
+/// @details    This header provides @ref Z4GE::Arena, a monotonic allocator that serves allocations by bumping a pointer
+///             within large chunks and releases them all at once, replacing the `malloc` / `free` churn of short-lived
+///             per-request or per-frame allocations.
+///                 -#  The arena grows by chaining chunks of (at least) the configured chunk size, and keeps the chunks for
+///                     reuse when it is reset or rewound.
+///                 -#  @ref Z4GE::Arena::Reset "Reset" releases every allocation in O(1).
+///                 -#  @ref Z4GE::Arena::Frame "Frame" checkpoints the arena and rolls it back when it goes out of scope.
+///                 -#  @ref Z4GE::ArenaMemoryResource adapts the arena to `std::pmr::memory_resource`, when the standard
+///                     library provides it ( @ref Z4GE_ARENA_HAS_MEMORY_RESOURCE is set ).
+///             @code
+///                 Z4GE::Arena Scratch;
+///                 for (;;) {
+///                     Z4GE::Arena::Frame Frame (Scratch);
+///                     float* Samples = Scratch.Allocate<float> (Count);
+///                     ...
+///                 }   //  Samples is released here
+///             @endcode
+/// @note       Destructors of the objects created in an arena are never invoked. The arena is not thread-safe.
+/// @note       Unlike the other Z4GE.Configuration headers, this header is not included by @ref Z4GE/Configuration.hh
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/AlignedAlloc.hh>
+#include <Z4GE/Configuration/CacheLine.hh>
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#if Z4GE_CXX17_STANDARD_COMPLIANT && Z4GE_HAS_INCLUDE(<memory_resource>)
+#    include <memory_resource>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether @ref Z4GE::ArenaMemoryResource (`std::pmr::memory_resource` adapter) is available
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_ARENA_HAS_MEMORY_RESOURCE
+#    if defined(__cpp_lib_memory_resource)
+#        define Z4GE_ARENA_HAS_MEMORY_RESOURCE Z4GE_ENABLE
+#    else
+#        define Z4GE_ARENA_HAS_MEMORY_RESOURCE Z4GE_DISABLE
+#    endif
+#endif
+
+namespace Z4GE {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Monotonic (bump-pointer) arena
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class Arena {
+        struct Chunk {
+            Chunk*      Next;
+            std::size_t Size; ///!    Usable bytes following the header
+        };
+
+        /// @brief  Chunks are cache line aligned, and so is the first byte following the header
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t ChunkAlignment = Z4GE_CACHELINE_SIZE;
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t HeaderSize =
+          (sizeof (Chunk) + ChunkAlignment - 1) / ChunkAlignment * ChunkAlignment;
+
+    public:
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t DefaultChunkSize = 64 * 1024;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      A position within the arena, used to roll allocations back
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Marker {
+            Chunk* Current;
+            char*  Cursor;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Scoped checkpoint, releasing the allocations made during its lifetime upon destruction
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class Frame {
+        public:
+            explicit Frame (Arena& Target) Z4GE_NOEXCEPT : Owner (Target), Checkpoint (Target.Mark ()) {}
+            ~Frame (void) { Owner.Rewind (Checkpoint); }
+
+            Frame (const Frame&) = delete;
+            Frame& operator= (const Frame&) = delete;
+
+        private:
+            Arena&       Owner;
+            const Marker Checkpoint;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Constructs an empty arena. No memory is allocated until the first allocation
+        /// @param[in]  MinimumChunkSize    The minimum number of usable bytes of each chunk
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit Arena (std::size_t MinimumChunkSize = DefaultChunkSize) Z4GE_NOEXCEPT
+          : First (nullptr), Current (nullptr), Cursor (nullptr), ChunkSize (MinimumChunkSize ? MinimumChunkSize : 1) {}
+
+        ~Arena (void) { Release (); }
+
+        Arena (const Arena&) = delete;
+        Arena& operator= (const Arena&) = delete;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Allocates @p Size bytes aligned to @p Alignment
+        /// @param[in]  Size        Number of bytes
+        /// @param[in]  Alignment   The alignment, in bytes. Must be a power of two
+        /// @returns    The uninitialized block, `nullptr` if a new chunk could not be allocated
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Z4GE_RESTRICT_RETURN void* Allocate (std::size_t Size,
+                                             std::size_t Alignment = Z4GE_ALIGN_OF (std::max_align_t)) Z4GE_NOEXCEPT {
+            if (Z4GE_LIKELY (Current != nullptr)) {
+                char* const Aligned = AlignUp (Cursor, Alignment);
+                if (Z4GE_LIKELY (Aligned <= End (Current) && Size <= static_cast<std::size_t> (End (Current) - Aligned))) {
+                    Cursor = Aligned + Size;
+                    return Aligned;
+                }
+            }
+            return AllocateSlow (Size, Alignment);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Allocates uninitialized storage for @p Count objects of type @p T, aligned to `Z4GE_ALIGN_OF (T)`
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename T>
+        Z4GE_RESTRICT_RETURN T* Allocate (std::size_t Count = 1) Z4GE_NOEXCEPT {
+            if (Count > static_cast<std::size_t> (-1) / sizeof (T)) {
+                return nullptr;
+            }
+            return static_cast<T*> (Allocate (Count * sizeof (T), Z4GE_ALIGN_OF (T)));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Constructs an object of type @p T in the arena. Its destructor is never invoked
+        /// @returns    The object, `nullptr` if a new chunk could not be allocated
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename T, typename... Arguments>
+        T* Create (Arguments&&... Values) {
+            void* Storage = Allocate (sizeof (T), Z4GE_ALIGN_OF (T));
+            return Storage ? new (Storage) T (std::forward<Arguments> (Values)...) : nullptr;
+        }
+
+        /// @brief  Returns the current position, to be passed to @ref Rewind
+        Marker Mark (void) const Z4GE_NOEXCEPT {
+            Marker Result = { Current, Cursor };
+            return Result;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Releases every allocation made after @p Checkpoint was taken. The chunks are kept for reuse
+        /// @note       @p Checkpoint is invalidated by @ref Release
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Rewind (const Marker& Checkpoint) Z4GE_NOEXCEPT {
+            if (Checkpoint.Current) {
+                Current = Checkpoint.Current;
+                Cursor  = Checkpoint.Cursor;
+            } else {
+                Reset ();
+            }
+        }
+
+        /// @brief  Releases every allocation in O(1). The chunks are kept for reuse
+        void Reset (void) Z4GE_NOEXCEPT {
+            Current = First;
+            Cursor  = First ? Begin (First) : nullptr;
+        }
+
+        /// @brief  Releases every allocation and returns the chunks to the system
+        void Release (void) Z4GE_NOEXCEPT {
+            while (First) {
+                Chunk* const Next = First->Next;
+                AlignedFree (First, ChunkAlignment);
+                First = Next;
+            }
+            Current = nullptr;
+            Cursor  = nullptr;
+        }
+
+        /// @brief  Total number of usable bytes of the chunks owned by the arena
+        std::size_t Capacity (void) const Z4GE_NOEXCEPT {
+            std::size_t Result = 0;
+            for (const Chunk* Iterator = First; Iterator; Iterator = Iterator->Next) Result += Iterator->Size;
+            return Result;
+        }
+
+    private:
+        static char* Begin (Chunk* Owner) Z4GE_NOEXCEPT { return reinterpret_cast<char*> (Owner) + HeaderSize; }
+        static char* End (Chunk* Owner) Z4GE_NOEXCEPT { return Begin (Owner) + Owner->Size; }
+
+        static char* AlignUp (char* Pointer, std::size_t Alignment) Z4GE_NOEXCEPT {
+            const std::uintptr_t Address = reinterpret_cast<std::uintptr_t> (Pointer);
+            return Pointer + (((Address + Alignment - 1) & ~(Alignment - 1)) - Address);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Moves to the next chunk that fits the allocation, or chains a new chunk after the current one
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Z4GE_NOINLINE void* AllocateSlow (std::size_t Size, std::size_t Alignment) Z4GE_NOEXCEPT {
+            //  Chunks are aligned to ChunkAlignment, thus only stricter alignments require slack
+            const std::size_t Slack = Alignment > ChunkAlignment ? Alignment - 1 : 0;
+            if (Size > static_cast<std::size_t> (-1) - Slack - HeaderSize) {
+                return nullptr;
+            }
+            const std::size_t Required = Size + Slack;
+
+            Chunk* Next = Current ? Current->Next : First;
+            if (!Next || Next->Size < Required) {
+                const std::size_t Usable  = Required > ChunkSize ? Required : ChunkSize;
+                void* const       Storage = AlignedAlloc (HeaderSize + Usable, ChunkAlignment);
+                if (!Storage) {
+                    return nullptr;
+                }
+                Chunk* const Fresh = static_cast<Chunk*> (Storage);
+                Fresh->Next        = Next;
+                Fresh->Size        = Usable;
+                if (Current) {
+                    Current->Next = Fresh;
+                } else {
+                    First = Fresh;
+                }
+                Next = Fresh;
+            }
+
+            Current             = Next;
+            char* const Aligned = AlignUp (Begin (Current), Alignment);
+            Cursor              = Aligned + Size;
+            return Aligned;
+        }
+
+        Chunk*      First;
+        Chunk*      Current;
+        char*       Cursor;
+        std::size_t ChunkSize;
+    };
+
+#if Z4GE_ARENA_HAS_MEMORY_RESOURCE
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Adapts a @ref Z4GE::Arena to `std::pmr::memory_resource`
+    /// @details    Deallocation is a no-op, memory is reclaimed by resetting, rewinding or destroying the arena.
+    ///             @code
+    ///                 Z4GE::Arena               Scratch;
+    ///                 Z4GE::ArenaMemoryResource Resource (Scratch);
+    ///                 std::pmr::vector<int>     Values (&Resource);
+    ///             @endcode
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class ArenaMemoryResource : public std::pmr::memory_resource {
+    public:
+        explicit ArenaMemoryResource (Arena& Target) Z4GE_NOEXCEPT : Owner (Target) {}
+
+    private:
+        void* do_allocate (std::size_t Size, std::size_t Alignment) Z4GE_OVERRIDE {
+            void* const Pointer = Owner.Allocate (Size, Alignment);
+            if (!Pointer) {
+                throw std::bad_alloc ();
+            }
+            return Pointer;
+        }
+
+        void do_deallocate (void*, std::size_t, std::size_t) Z4GE_OVERRIDE {}
+
+        bool do_is_equal (const std::pmr::memory_resource& Other) const Z4GE_NOEXCEPT Z4GE_OVERRIDE { return this == &Other; }
+
+        Arena& Owner;
+    };
+#endif
+
+} // namespace Z4GE
+
+/// @}
+
+#endif
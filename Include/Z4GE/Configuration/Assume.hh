@@ -0,0 +1,179 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__ASSUME_HH_
+#define Z4GE_CONFIGURATION__ASSUME_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/Assume.hh
+/// @brief      Compiler independent optimizer hints
+/// @details    This header provides @ref Z4GE_ASSUME, @ref Z4GE_UNREACHABLE and @ref Z4GE_ASSUME_ALIGNED, which let the
+///             optimizer drop code for cases that cannot happen: the default branch of a switch over an exhaustive enum,
+///             the range checks of an index known to be in bounds, or the peeled prologue and runtime alignment checks of
+///             a vectorized loop over a buffer allocated with @ref Z4GE::AlignedAlloc.
+///
+///             |  Macro                      |  GCC                        |  Clang                      |  MSVC            |
+///             | --------------------------- | --------------------------- | --------------------------- | ---------------- |
+///             | Z4GE_ASSUME                 | `__builtin_unreachable`     | `__builtin_assume`          | `__assume`       |
+///             | Z4GE_UNREACHABLE            | `__builtin_unreachable`     | `__builtin_unreachable`     | `__assume(0)`    |
+///             | Z4GE_ASSUME_ALIGNED         | `__builtin_assume_aligned`  | `__builtin_assume_aligned`  | `__assume`       |
+///
+///             `std::assume_aligned` is used instead when the standard library provides it.
+/// @par        Debug Mode
+///             A hint that does not hold is undefined behaviour. When @ref Z4GE_ASSUME_DEBUG is set (by default, unless
+///             `NDEBUG` is defined), every hint is checked instead and the process is trapped (see @ref Z4GE_TRAP) at the
+///             offending site.
+/// @note       The expression given to @ref Z4GE_ASSUME must be free of side effects, since whether it is evaluated depends
+///             upon the compiler and the debug mode.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#if Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+#    include <intrin.h>
+#elif !(Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC | Z4GE_COMPILER_INTEL))
+#    include <cstdlib>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether optimizer hints are checked at runtime instead of being assumed
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_ASSUME_DEBUG
+#    if defined(NDEBUG)
+#        define Z4GE_ASSUME_DEBUG Z4GE_DISABLE
+#    else
+#        define Z4GE_ASSUME_DEBUG Z4GE_ENABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether `std::assume_aligned` is provided by the standard library
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HAS_STD_ASSUME_ALIGNED
+#    if defined(__cpp_lib_assume_aligned) && __cpp_lib_assume_aligned >= 201811L
+#        define Z4GE_HAS_STD_ASSUME_ALIGNED Z4GE_ENABLE
+#    else
+#        define Z4GE_HAS_STD_ASSUME_ALIGNED Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Abnormally terminates the process at the call site
+/// @details    This macro expands to the trap instruction of the target (eg. `ud2`, `brk`), which stops a debugger at the
+///             offending site, or to `std::abort` if no trap intrinsic is available.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_TRAP
+#    if Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC | Z4GE_COMPILER_INTEL)
+#        define Z4GE_TRAP() __builtin_trap ()
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+#        define Z4GE_TRAP() __fastfail (7)
+#    else
+#        define Z4GE_TRAP() std::abort ()
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent hint that a code path is never reached
+/// @details    This macro tells the optimizer that the control flow never reaches it, so that eg. the default branch of a
+///             switch over every enumerator of a @ref Z4GE_PLATFORM or @ref Z4GE_COMPILER like enumeration, and the range
+///             check of its jump table, are removed. In debug mode, reaching it traps.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_UNREACHABLE
+#    if Z4GE_ASSUME_DEBUG
+#        define Z4GE_UNREACHABLE() Z4GE_TRAP ()
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC)
+#        define Z4GE_UNREACHABLE() __builtin_unreachable ()
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_MSVC | Z4GE_COMPILER_INTEL)
+#        define Z4GE_UNREACHABLE() __assume (0)
+#    else
+#        define Z4GE_UNREACHABLE() Z4GE_TRAP ()
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent hint that an expression always evaluates to true
+/// @details    This macro tells the optimizer that @p __EXPRESSION__ holds at this point of the program (eg. that an index
+///             is in bounds or that a size is a non-zero multiple of the vector width), and expands to nothing on compilers
+///             without such a hint. In debug mode, @p __EXPRESSION__ is evaluated and the process traps if it is false.
+/// @param      __EXPRESSION__  A side effect free boolean expression
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_ASSUME
+#    if Z4GE_ASSUME_DEBUG
+#        define Z4GE_ASSUME(__EXPRESSION__) ((__EXPRESSION__) ? static_cast<void> (0) : Z4GE_TRAP ())
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG) && Z4GE_HAS_BUILTIN(__builtin_assume)
+#        define Z4GE_ASSUME(__EXPRESSION__) __builtin_assume (__EXPRESSION__)
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_MSVC | Z4GE_COMPILER_INTEL)
+#        define Z4GE_ASSUME(__EXPRESSION__) __assume (__EXPRESSION__)
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC)
+#        define Z4GE_ASSUME(__EXPRESSION__) ((__EXPRESSION__) ? static_cast<void> (0) : __builtin_unreachable ())
+#    else
+#        define Z4GE_ASSUME(__EXPRESSION__) static_cast<void> (0)
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent hint that a pointer is aligned
+/// @details    This macro evaluates to @p __POINTER__, with the same type, which the optimizer may assume to be aligned to
+///             @p __ALIGNMENT__ bytes. Loads and stores through the returned pointer can then use aligned instructions, and
+///             vectorized loops over it no longer need a peeled prologue or a runtime alignment check. In debug mode, the
+///             alignment of @p __POINTER__ is verified and the process traps if it is misaligned.
+/// @param      __POINTER__     The pointer
+/// @param      __ALIGNMENT__   The alignment, in bytes. Must be a power of two constant expression
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_ASSUME_ALIGNED
+#    define Z4GE_ASSUME_ALIGNED(__POINTER__, __ALIGNMENT__) ::Z4GE::Detail::AssumeAligned<(__ALIGNMENT__)> (__POINTER__)
+#endif
+
+namespace Z4GE { namespace Detail {
+
+    /// @brief  Implementation of @ref Z4GE_ASSUME_ALIGNED
+    template<std::size_t Alignment, typename T>
+    Z4GE_NODISCARD inline T* AssumeAligned (T* Pointer) Z4GE_NOEXCEPT {
+        Z4GE_STATIC_ASSERT (Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+#if Z4GE_ASSUME_DEBUG
+        if (reinterpret_cast<std::uintptr_t> (Pointer) % Alignment != 0) { Z4GE_TRAP (); }
+#endif
+
+#if Z4GE_HAS_STD_ASSUME_ALIGNED
+        return std::assume_aligned<Alignment> (Pointer);
+#elif Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC | Z4GE_COMPILER_INTEL)
+        return static_cast<T*> (__builtin_assume_aligned (Pointer, Alignment));
+#elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+        __assume (reinterpret_cast<std::uintptr_t> (Pointer) % Alignment == 0);
+        return Pointer;
+#else
+        return Pointer;
+#endif
+    }
+
+}} // namespace Z4GE::Detail
+
+/// @}
+
+#endif
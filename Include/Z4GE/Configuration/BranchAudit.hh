@@ -0,0 +1,265 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__BRANCH_AUDIT_HH_
+#define Z4GE_CONFIGURATION__BRANCH_AUDIT_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/BranchAudit.hh
+/// @brief      Auditing of the branch prediction hints
+/// @details    When @ref Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS is set, every @ref Z4GE_LIKELY and @ref Z4GE_UNLIKELY expands
+///             to a per-site counter that records whether the hinted expression evaluated to `true` or `false`. Each site
+///             is identified by its file, line and enclosing function (see @ref Z4GE_CURRENT_FUNCTION), and is registered
+///             once, on its first evaluation. Outcomes are recorded in a table owned by the evaluating thread, with plain
+///             relaxed loads and stores, thus auditing neither locks nor bounces cache lines between threads.
+///
+///             At exit, the sites whose hinted outcome occurred in less than half of their evaluations are written to the
+///             standard error stream. @ref Z4GE::BranchAudit::Collect and @ref Z4GE::BranchAudit::Report can be used to
+///             inspect the counters earlier, eg. at the end of a benchmark.
+/// @note       This header is included by @ref Z4GE/Configuration/CompilerTraits.hh when auditing is enabled, and is not
+///             meant to be included directly. Auditing is meant for profiling builds only, since every hinted branch then
+///             costs a function-local static guard check and a thread-local table lookup.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Maximum number of audited sites whose outcomes are recorded in the per-thread tables
+/// @details    Sites registered beyond this limit are recorded in shared atomic counters instead.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_BRANCH_AUDIT_MAX_SITES
+#    define Z4GE_BRANCH_AUDIT_MAX_SITES 4096
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Records the outcome of @p __EXPRESSION__ at the current site, and evaluates to it
+/// @param      __EXPRESSION__  The hinted expression
+/// @param      __EXPECTED__    The hinted outcome
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define Z4GE_BRANCH_AUDIT_RECORD(__EXPRESSION__, __EXPECTED__)                                                                 \
+    ::Z4GE::BranchAudit::Record (                                                                                              \
+        [] (const char* Z4GE_AuditedFunction) -> ::Z4GE::BranchAudit::Site& {                                                  \
+            static ::Z4GE::BranchAudit::Site Z4GE_AuditedSite (__FILE__, __LINE__, Z4GE_AuditedFunction, (__EXPECTED__));     \
+            return Z4GE_AuditedSite;                                                                                           \
+        }(Z4GE_CURRENT_FUNCTION),                                                                                              \
+        !!(__EXPRESSION__))
+
+namespace Z4GE { namespace BranchAudit {
+
+    /// @brief  A hinted branch, registered on its first evaluation
+    struct Site {
+        const char*                File;
+        unsigned                   Line;
+        const char*                Function;
+        bool                       Expected;
+        std::size_t                Index;
+        Site*                      Next;
+        std::atomic<std::uint64_t> OverflowTaken;
+        std::atomic<std::uint64_t> OverflowNotTaken;
+
+        inline Site (const char* SiteFile, unsigned SiteLine, const char* SiteFunction, bool SiteExpected);
+
+        Site (const Site&)            = delete;
+        Site& operator= (const Site&) = delete;
+    };
+
+    /// @brief  Outcome counters of a single site, written by the owning thread only
+    struct Counters {
+        std::atomic<std::uint64_t> Taken;
+        std::atomic<std::uint64_t> NotTaken;
+    };
+
+    /// @brief  Outcome counters of every site, as recorded by a single thread. Tables are never freed, so that the
+    ///         outcomes recorded by threads that have already exited are still reported
+    struct ThreadTable {
+        Counters     Sites[Z4GE_BRANCH_AUDIT_MAX_SITES];
+        ThreadTable* Next;
+    };
+
+    /// @brief  Outcomes of a hinted branch, summed across every thread
+    struct SiteReport {
+        const char*   File;
+        unsigned      Line;
+        const char*   Function;
+        bool          Expected;
+        std::uint64_t Taken;
+        std::uint64_t NotTaken;
+
+        /// @brief  Number of evaluations whose outcome matched the hint
+        std::uint64_t Hits (void) const { return Expected ? Taken : NotTaken; }
+
+        /// @brief  Number of evaluations whose outcome contradicted the hint
+        std::uint64_t Misses (void) const { return Expected ? NotTaken : Taken; }
+
+        /// @brief  Fraction of the evaluations whose outcome contradicted the hint
+        double MissRate (void) const {
+            return Misses () == 0 ? 0.0 : static_cast<double> (Misses ()) / static_cast<double> (Hits () + Misses ());
+        }
+
+        /// @brief  Whether the hint was wrong for most of the evaluations of the site
+        bool IsMispredicted (void) const { return Misses () > Hits (); }
+    };
+
+    inline void Report (std::FILE* Stream, bool AllSites = false);
+
+    namespace Detail {
+
+        struct Registry {
+            std::atomic<Site*>        Sites;
+            std::atomic<ThreadTable*> Tables;
+            std::atomic<std::size_t>  SiteCount;
+        };
+
+        inline Registry& GetRegistry (void) {
+            static Registry Instance = { {nullptr}, {nullptr}, {0} };
+            return Instance;
+        }
+
+        inline void ReportAtExit (void) { Report (stderr); }
+
+        Z4GE_NOINLINE inline ThreadTable* CreateThreadTable (void) {
+            ThreadTable* const Table = new ThreadTable ();
+            Registry&          State = GetRegistry ();
+
+            Table->Next = State.Tables.load (std::memory_order_relaxed);
+            while (!State.Tables.compare_exchange_weak (Table->Next, Table, std::memory_order_release,
+                                                        std::memory_order_relaxed)) {}
+            return Table;
+        }
+
+        inline ThreadTable& GetThreadTable (void) {
+            static thread_local ThreadTable* Table = nullptr;
+            if (Table == nullptr) { Table = CreateThreadTable (); }
+            return *Table;
+        }
+
+        inline void Increment (std::atomic<std::uint64_t>& Counter) {
+            Counter.store (Counter.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        inline bool IsSameSite (const SiteReport& Left, const Site& Right) {
+            return Left.Line == Right.Line && Left.Expected == Right.Expected && std::strcmp (Left.File, Right.File) == 0;
+        }
+
+    } // namespace Detail
+
+    inline Site::Site (const char* SiteFile, unsigned SiteLine, const char* SiteFunction, bool SiteExpected)
+      : File (SiteFile), Line (SiteLine), Function (SiteFunction), Expected (SiteExpected), Index (0), Next (nullptr),
+        OverflowTaken (0), OverflowNotTaken (0) {
+        Detail::Registry& State = Detail::GetRegistry ();
+
+        Index = State.SiteCount.fetch_add (1, std::memory_order_relaxed);
+        if (Index == 0) { std::atexit (Detail::ReportAtExit); }
+
+        Next = State.Sites.load (std::memory_order_relaxed);
+        while (!State.Sites.compare_exchange_weak (Next, this, std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Records the outcome of an evaluation of @p Target in the table of the calling thread
+    /// @returns    @p Outcome
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool Record (Site& Target, bool Outcome) {
+        if (Target.Index < Z4GE_BRANCH_AUDIT_MAX_SITES) {
+            Counters& Slot = Detail::GetThreadTable ().Sites[Target.Index];
+            Detail::Increment (Outcome ? Slot.Taken : Slot.NotTaken);
+        } else {
+            (Outcome ? Target.OverflowTaken : Target.OverflowNotTaken).fetch_add (1, std::memory_order_relaxed);
+        }
+        return Outcome;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Sums the outcomes of every registered site across every thread
+    /// @details    Sites sharing a file, a line and a hint (eg. the instantiations of a function template) are merged. The
+    ///             counters of threads that are still running are read without synchronization and may lag behind.
+    /// @returns    The sites, the most mispredicted first
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline std::vector<SiteReport> Collect (void) {
+        Detail::Registry&       State = Detail::GetRegistry ();
+        std::vector<SiteReport> Reports;
+
+        for (const Site* Current = State.Sites.load (std::memory_order_acquire); Current != nullptr; Current = Current->Next) {
+            std::uint64_t Taken    = Current->OverflowTaken.load (std::memory_order_relaxed);
+            std::uint64_t NotTaken = Current->OverflowNotTaken.load (std::memory_order_relaxed);
+            if (Current->Index < Z4GE_BRANCH_AUDIT_MAX_SITES) {
+                for (const ThreadTable* Table = State.Tables.load (std::memory_order_acquire); Table != nullptr;
+                     Table                    = Table->Next) {
+                    Taken += Table->Sites[Current->Index].Taken.load (std::memory_order_relaxed);
+                    NotTaken += Table->Sites[Current->Index].NotTaken.load (std::memory_order_relaxed);
+                }
+            }
+
+            std::size_t Position = 0;
+            while (Position < Reports.size () && !Detail::IsSameSite (Reports[Position], *Current)) { ++Position; }
+            if (Position == Reports.size ()) {
+                const SiteReport Entry = { Current->File, Current->Line, Current->Function, Current->Expected, 0, 0 };
+                Reports.push_back (Entry);
+            }
+            Reports[Position].Taken += Taken;
+            Reports[Position].NotTaken += NotTaken;
+        }
+
+        std::sort (Reports.begin (), Reports.end (),
+                   [] (const SiteReport& Left, const SiteReport& Right) { return Left.MissRate () > Right.MissRate (); });
+        return Reports;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Writes the mispredicted sites, or every site if @p AllSites is set, to @p Stream
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline void Report (std::FILE* Stream, bool AllSites) {
+        const std::vector<SiteReport> Reports = Collect ();
+
+        std::size_t Mispredicted = 0;
+        for (std::size_t Index = 0; Index < Reports.size (); ++Index) { Mispredicted += Reports[Index].IsMispredicted (); }
+        std::fprintf (Stream, "Z4GE branch hint audit: %llu of %llu hinted sites mispredicted\n",
+                      static_cast<unsigned long long> (Mispredicted), static_cast<unsigned long long> (Reports.size ()));
+
+        for (std::size_t Index = 0; Index < Reports.size (); ++Index) {
+            const SiteReport& Entry = Reports[Index];
+            if (!AllSites && !Entry.IsMispredicted ()) { continue; }
+
+            std::fprintf (Stream, "  %s:%u: %s in %s, %llu of %llu evaluations (%.1f%%) contradict the hint\n", Entry.File,
+                          Entry.Line, Entry.Expected ? "Z4GE_LIKELY" : "Z4GE_UNLIKELY", Entry.Function,
+                          static_cast<unsigned long long> (Entry.Misses ()),
+                          static_cast<unsigned long long> (Entry.Hits () + Entry.Misses ()), 100.0 * Entry.MissRate ());
+        }
+    }
+
+}} // namespace Z4GE::BranchAudit
+
+/// @}
+
+#endif
@@ -0,0 +1,293 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__BUILD_NOTE_HH_
+#define Z4GE_CONFIGURATION__BUILD_NOTE_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/BuildNote.hh
+/// @brief      Build Capabilities ELF Note
+/// @details    When @ref Z4GE_CONFIGURATION_BUILD_NOTE is set, this header places an ELF note named `Z4GE` in the
+///             `.note.z4ge` section of the including translation unit. The note records the configuration the translation
+///             unit was compiled with: @ref Z4GE_ARCHITECTURE, @ref Z4GE_COMPILER, @ref Z4GE_COMPILER_VERSION,
+///             @ref Z4GE_BUILD_MODEL, the C++ standard level and the key `Z4GE_HAS_*` flags (see
+///             @ref Z4GE::Configuration::BuildNoteFeature "BuildNoteFeature").
+///
+///             The linker concatenates the notes of every translation unit, so a program carries one note per distinct
+///             configuration, and a library compiled for a lower architecture than the program stands out. The notes are
+///             read without executing the file by @ref Z4GE::Configuration::ReadBuildNotes "ReadBuildNotes", which the
+///             `BuildNoteReader` utility prints, eg.
+///             @code
+///                 $ BuildNoteReader --minimum x86-64-v3 Server
+///             @endcode
+///
+///             The CMake option `Z4GE_CONFIGURATION_BUILD_NOTE` adds a translation unit that sets the note to every target
+///             linking `Z4GE::Configuration`.
+/// @note       Notes are only emitted for ELF targets. Unlike the other Z4GE.Configuration headers, this header is not
+///             included by @ref Z4GE/Configuration.hh since it depends on the standard library.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Features.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Places the build note in the including translation unit
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CONFIGURATION_BUILD_NOTE
+#    define Z4GE_CONFIGURATION_BUILD_NOTE Z4GE_DISABLE
+#endif
+
+/// @brief      Owner name of the build note
+#define Z4GE_BUILD_NOTE_NAME "Z4GE"
+/// @brief      Type of the build note
+#define Z4GE_BUILD_NOTE_TYPE 1
+/// @brief      Layout version of @ref Z4GE::Configuration::BuildNoteDescription "BuildNoteDescription"
+#define Z4GE_BUILD_NOTE_VERSION 1
+
+/// @brief      The C++ standard level recorded by the build note
+#define Z4GE_BUILD_NOTE_STANDARD Z4GE_CXX_STANDARD_LEVEL
+
+namespace Z4GE { namespace Configuration {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Build Note Features
+    /// @details    The `Z4GE_HAS_*` flags recorded by the build note
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum BuildNoteFeature {
+        BuildNoteConstexpr                = 0x0001, ///!    @ref Z4GE_HAS_CONSTEXPR
+        BuildNoteNoexcept                 = 0x0002, ///!    @ref Z4GE_HAS_NOEXCEPT
+        BuildNoteIfConstexpr              = 0x0004, ///!    @ref Z4GE_HAS_IF_CONSTEXPR
+        BuildNoteConstinit                = 0x0008, ///!    @ref Z4GE_HAS_CONSTINIT
+        BuildNoteConsteval                = 0x0010, ///!    @ref Z4GE_HAS_CONSTEVAL
+        BuildNoteAlignedNew               = 0x0020, ///!    @ref Z4GE_HAS_ALIGNED_NEW
+        BuildNoteLikelyAttribute          = 0x0040, ///!    @ref Z4GE_HAS_LIKELY_ATTRIBUTE
+        BuildNoteAssumeAttribute          = 0x0080, ///!    @ref Z4GE_HAS_ASSUME_ATTRIBUTE
+        BuildNoteNoUniqueAddressAttribute = 0x0100, ///!    @ref Z4GE_HAS_NO_UNIQUE_ADDRESS_ATTRIBUTE
+        BuildNoteTargetAttribute          = 0x0200, ///!    @ref Z4GE_HAS_TARGET_ATTRIBUTE
+        BuildNoteTargetClonesAttribute    = 0x0400, ///!    @ref Z4GE_HAS_TARGET_CLONES_ATTRIBUTE
+        BuildNoteIfuncAttribute           = 0x0800, ///!    @ref Z4GE_HAS_IFUNC_ATTRIBUTE
+        BuildNoteAuditBranchHints         = 0x1000  ///!    @ref Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS, ie. a profiling build
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      The description of the build note
+    /// @details    Every field is stored in the byte order of the target
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct BuildNoteDescription {
+        std::uint32_t Version;         ///!    @ref Z4GE_BUILD_NOTE_VERSION
+        std::uint32_t Architecture;    ///!    @ref Z4GE_ARCHITECTURE
+        std::uint32_t Compiler;        ///!    @ref Z4GE_COMPILER
+        std::uint32_t CompilerVersion; ///!    @ref Z4GE_COMPILER_VERSION
+        std::uint32_t BuildModel;      ///!    @ref Z4GE_BUILD_MODEL
+        std::uint32_t Standard;        ///!    @ref Z4GE_BUILD_NOTE_STANDARD
+        std::uint32_t Features;        ///!    @ref BuildNoteFeature flags
+    };
+
+    namespace Detail {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      An ELF note: its header, its 4-byte aligned owner name and its description
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct BuildNoteRecord {
+            std::uint32_t        NameSize;
+            std::uint32_t        DescriptionSize;
+            std::uint32_t        Type;
+            char                 Name[8];
+            BuildNoteDescription Description;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Reads an unsigned integer of @p Size bytes at @p Offset of @p Data, in the given byte order
+        /// @note       Offsets and sizes are truncated to `std::size_t`, which limits 32-bit hosts to files below 4 GiB
+        /// @returns    `false` if the integer lies beyond @p Data
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool ReadElfInteger (const std::vector<unsigned char>& Data, std::size_t Offset, unsigned Size,
+                                    bool BigEndian, std::size_t& Value) {
+            if (Offset > Data.size () || Data.size () - Offset < Size) {
+                return false;
+            }
+            Value = 0;
+            for (unsigned Index = 0; Index < Size; ++Index) {
+                const std::size_t Byte = Data[Offset + (BigEndian ? Index : Size - 1 - Index)];
+                Value                    = (Value << 8) | Byte;
+            }
+            return true;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Reads @p Size bytes at @p Offset of @p File
+        /// @details    The range is checked against the size of @p File before @p Data is resized, since both come from
+        ///             the headers of the file and cannot be trusted.
+        /// @returns    `false` if the range lies beyond @p File
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool ReadFileRange (std::ifstream& File, std::size_t Offset, std::size_t Size,
+                                   std::vector<unsigned char>& Data) {
+            File.clear ();
+            File.seekg (0, std::ios::end);
+            const std::streamoff End = File.tellg ();
+            if (End < 0 || Offset > static_cast<unsigned long long> (End) ||
+                static_cast<unsigned long long> (End) - Offset < Size) {
+                return false;
+            }
+            Data.resize (Size);
+            File.seekg (static_cast<std::streamoff> (Offset));
+            return Size == 0 || static_cast<bool> (File.read (reinterpret_cast<char*> (&Data[0]),
+                                                              static_cast<std::streamsize> (Size)));
+        }
+
+    } // namespace Detail
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Read the build notes of an ELF file
+    /// @details    Every `SHT_NOTE` section is searched for notes named @ref Z4GE_BUILD_NOTE_NAME, of type
+    ///             @ref Z4GE_BUILD_NOTE_TYPE. The file is not executed; files of another byte order are supported.
+    /// @param[in]  Path    The path of the ELF file
+    /// @param[out] Notes   The build notes found in the file, in their order of appearance
+    /// @returns    `false` if the file could not be read, is not an ELF file or its section headers lie beyond it
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool ReadBuildNotes (const char* Path, std::vector<BuildNoteDescription>& Notes) {
+        Notes.clear ();
+        std::ifstream File (Path, std::ios::binary);
+        if (!File) {
+            return false;
+        }
+
+        //  ELF identification and header
+        std::vector<unsigned char> Header;
+        if (!Detail::ReadFileRange (File, 0, 64, Header)) {
+            return false;
+        }
+        if (Header[0] != 0x7F || Header[1] != 'E' || Header[2] != 'L' || Header[3] != 'F') {
+            return false;
+        }
+        const bool     Elf64     = Header[4] == 2;
+        const bool     BigEndian = Header[5] == 2;
+        const unsigned Address   = Elf64 ? 8u : 4u;
+
+        std::size_t SectionOffset = 0, SectionEntrySize = 0, SectionCount = 0;
+        if (!Detail::ReadElfInteger (Header, Elf64 ? 0x28u : 0x20u, Address, BigEndian, SectionOffset) ||
+            !Detail::ReadElfInteger (Header, Elf64 ? 0x3Au : 0x2Eu, 2, BigEndian, SectionEntrySize) ||
+            !Detail::ReadElfInteger (Header, Elf64 ? 0x3Cu : 0x30u, 2, BigEndian, SectionCount)) {
+            return false;
+        }
+        //  Section headers smaller than Elf64_Shdr / Elf32_Shdr would overlap
+        if (SectionCount != 0 && SectionEntrySize < (Elf64 ? 0x40u : 0x28u)) {
+            return false;
+        }
+
+        std::vector<unsigned char> Sections;
+        if (!Detail::ReadFileRange (File, SectionOffset, SectionEntrySize * SectionCount, Sections)) {
+            return false;
+        }
+        for (std::size_t Section = 0; Section < SectionCount; ++Section) {
+            //  SHT_NOTE sections, whose notes are padded to their alignment (4, or 8 for eg. .note.gnu.property)
+            const std::size_t Entry = Section * SectionEntrySize;
+            std::size_t       Type = 0, Offset = 0, Size = 0, Alignment = 0;
+            if (!Detail::ReadElfInteger (Sections, Entry + 4, 4, BigEndian, Type) || Type != 7 ||
+                !Detail::ReadElfInteger (Sections, Entry + (Elf64 ? 0x18u : 0x10u), Address, BigEndian, Offset) ||
+                !Detail::ReadElfInteger (Sections, Entry + (Elf64 ? 0x20u : 0x14u), Address, BigEndian, Size) ||
+                !Detail::ReadElfInteger (Sections, Entry + (Elf64 ? 0x30u : 0x20u), Address, BigEndian, Alignment)) {
+                continue;
+            }
+            const std::size_t Padding = Alignment == 8 ? 7u : 3u;
+
+            std::vector<unsigned char> Data;
+            if (!Detail::ReadFileRange (File, Offset, Size, Data)) {
+                continue;
+            }
+            std::size_t Position = 0, NameSize = 0, DescriptionSize = 0, NoteType = 0;
+            while (Detail::ReadElfInteger (Data, Position, 4, BigEndian, NameSize) &&
+                   Detail::ReadElfInteger (Data, Position + 4, 4, BigEndian, DescriptionSize) &&
+                   Detail::ReadElfInteger (Data, Position + 8, 4, BigEndian, NoteType)) {
+                const std::size_t Name        = Position + 12;
+                const std::size_t Description = Name + ((NameSize + Padding) & ~Padding);
+                Position                        = Description + ((DescriptionSize + Padding) & ~Padding);
+                if (Position > Data.size ()) {
+                    break;
+                }
+                if (NameSize != sizeof (Z4GE_BUILD_NOTE_NAME) || NoteType != Z4GE_BUILD_NOTE_TYPE ||
+                    DescriptionSize < sizeof (BuildNoteDescription) ||
+                    std::memcmp (&Data[Name], Z4GE_BUILD_NOTE_NAME, NameSize) != 0) {
+                    continue;
+                }
+
+                std::size_t Fields[sizeof (BuildNoteDescription) / 4];
+                for (std::size_t Field = 0; Field < sizeof (Fields) / sizeof (Fields[0]); ++Field) {
+                    Detail::ReadElfInteger (Data, Description + Field * 4, 4, BigEndian, Fields[Field]);
+                }
+                const BuildNoteDescription Note = {
+                    static_cast<std::uint32_t> (Fields[0]), static_cast<std::uint32_t> (Fields[1]),
+                    static_cast<std::uint32_t> (Fields[2]), static_cast<std::uint32_t> (Fields[3]),
+                    static_cast<std::uint32_t> (Fields[4]), static_cast<std::uint32_t> (Fields[5]),
+                    static_cast<std::uint32_t> (Fields[6]),
+                };
+                Notes.push_back (Note);
+            }
+        }
+        return true;
+    }
+
+}} // namespace Z4GE::Configuration
+
+#if Z4GE_CONFIGURATION_BUILD_NOTE && defined(__ELF__)
+__attribute__ ((section (".note.z4ge"), used, aligned (4))) static const Z4GE::Configuration::Detail::BuildNoteRecord
+    Z4GE_BuildNote = {
+        sizeof (Z4GE_BUILD_NOTE_NAME),
+        sizeof (Z4GE::Configuration::BuildNoteDescription),
+        Z4GE_BUILD_NOTE_TYPE,
+        Z4GE_BUILD_NOTE_NAME,
+        {
+            Z4GE_BUILD_NOTE_VERSION,
+            Z4GE_ARCHITECTURE,
+            Z4GE_COMPILER,
+            Z4GE_COMPILER_VERSION,
+            Z4GE_BUILD_MODEL,
+            Z4GE_BUILD_NOTE_STANDARD,
+            (Z4GE_HAS_CONSTEXPR ? Z4GE::Configuration::BuildNoteConstexpr : 0) |
+                (Z4GE_HAS_NOEXCEPT ? Z4GE::Configuration::BuildNoteNoexcept : 0) |
+                (Z4GE_HAS_IF_CONSTEXPR ? Z4GE::Configuration::BuildNoteIfConstexpr : 0) |
+                (Z4GE_HAS_CONSTINIT ? Z4GE::Configuration::BuildNoteConstinit : 0) |
+                (Z4GE_HAS_CONSTEVAL ? Z4GE::Configuration::BuildNoteConsteval : 0) |
+                (Z4GE_HAS_ALIGNED_NEW ? Z4GE::Configuration::BuildNoteAlignedNew : 0) |
+                (Z4GE_HAS_LIKELY_ATTRIBUTE ? Z4GE::Configuration::BuildNoteLikelyAttribute : 0) |
+                (Z4GE_HAS_ASSUME_ATTRIBUTE ? Z4GE::Configuration::BuildNoteAssumeAttribute : 0) |
+                (Z4GE_HAS_NO_UNIQUE_ADDRESS_ATTRIBUTE ? Z4GE::Configuration::BuildNoteNoUniqueAddressAttribute : 0) |
+                (Z4GE_HAS_TARGET_ATTRIBUTE ? Z4GE::Configuration::BuildNoteTargetAttribute : 0) |
+                (Z4GE_HAS_TARGET_CLONES_ATTRIBUTE ? Z4GE::Configuration::BuildNoteTargetClonesAttribute : 0) |
+                (Z4GE_HAS_IFUNC_ATTRIBUTE ? Z4GE::Configuration::BuildNoteIfuncAttribute : 0) |
+                (Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS ? Z4GE::Configuration::BuildNoteAuditBranchHints : 0),
+        },
+};
+#endif
+
+/// @}
+
+#endif
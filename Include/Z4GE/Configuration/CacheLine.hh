@@ -0,0 +1,153 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__CACHE_LINE_HH_
+#define Z4GE_CONFIGURATION__CACHE_LINE_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/CacheLine.hh
+/// @brief      Cache line size constants and false-sharing-safe padded types
+/// @details    This header resolves the cache line size of the target architecture along with the destructive and
+///             constructive interference sizes, and provides @ref Z4GE::CachePadded and @ref Z4GE_CACHELINE_ALIGNED for
+///             keeping independently written data (eg. per-thread counters, queue head / tail indices) on separate cache
+///             lines.
+///
+///             |  Architecture              |  Cache line  |  Destructive interference  |  Constructive interference  |
+///             | -------------------------- | ------------ | -------------------------- | --------------------------- |
+///             | x86 / x86-64               | 64           | 128                        | 64                          |
+///             | AArch64 (Apple)            | 128          | 128                        | 128                         |
+///             | AArch64 (others)           | 64           | 128                        | 64                          |
+///             | PowerPC 64                 | 128          | 128                        | 128                         |
+///             | s390x                      | 256          | 256                        | 256                         |
+///             | Others                     | 64           | 64                         | 64                          |
+///
+///             The destructive interference size is larger than the cache line size on x86-64 and AArch64 since the
+///             spatial prefetchers of these processors fetch cache lines in adjacent pairs, and several AArch64 server
+///             processors use 128 byte lines. Every constant can be overridden by defining it before including this header.
+/// @note       `std::hardware_destructive_interference_size` is intentionally not used since its value may change with
+///             compiler flags (GCC warns about its use in headers for this reason), which would change the layout of the
+///             types that use it across translation units.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <cstddef>
+#if Z4GE_HAS_VARIADIC_TEMPLATES && Z4GE_HAS_RVALUE_REFERENCES
+#    include <type_traits>
+#    include <utility>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Size of a cache line, in bytes, of the target architecture
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CACHELINE_SIZE
+#    if defined(__APPLE__) && (defined(__aarch64__) || defined(__arm64__))
+#        define Z4GE_CACHELINE_SIZE 128
+#    elif defined(__powerpc64__) || defined(__ppc64__) || defined(_ARCH_PPC64)
+#        define Z4GE_CACHELINE_SIZE 128
+#    elif defined(__s390x__) || defined(__s390__)
+#        define Z4GE_CACHELINE_SIZE 256
+#    else
+#        define Z4GE_CACHELINE_SIZE 64
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Minimum offset, in bytes, between two objects to avoid false sharing
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE
+#    if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(__arm64__) || defined(_M_ARM64)
+#        define Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE (Z4GE_CACHELINE_SIZE > 128 ? Z4GE_CACHELINE_SIZE : 128)
+#    else
+#        define Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE Z4GE_CACHELINE_SIZE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Maximum size, in bytes, of contiguous memory to promote true sharing
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CONSTRUCTIVE_INTERFERENCE_SIZE
+#    define Z4GE_CONSTRUCTIVE_INTERFERENCE_SIZE Z4GE_CACHELINE_SIZE
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Aligns a type or a variable to avoid false sharing with its neighbours
+/// @details    This macro expands to @ref Z4GE_ALIGN_AS with @ref Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE, thus the object starts
+///             on its own cache line (pair) and, for types, the size is rounded up to a multiple of that alignment.
+///             @code
+///                 struct Z4GE_CACHELINE_ALIGNED Queue {
+///                     Z4GE_CACHELINE_ALIGNED std::atomic<std::size_t> Head;
+///                     Z4GE_CACHELINE_ALIGNED std::atomic<std::size_t> Tail;
+///                 };
+///             @endcode
+/// @note       Dynamically allocated over-aligned objects are only aligned by `new` since C++17
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CACHELINE_ALIGNED
+#    define Z4GE_CACHELINE_ALIGNED Z4GE_ALIGN_AS (Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE)
+#endif
+
+namespace Z4GE {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Pads and aligns a value so that it occupies cache lines of its own
+    /// @details    Adjacent `CachePadded` objects (eg. elements of an array of per-thread counters) never share a cache line,
+    ///             regardless of the size of @p T.
+    ///             @code
+    ///                 Z4GE::CachePadded<std::atomic<std::uint64_t>> Counters[ThreadCount];
+    ///                 Counters[ThreadIndex]->fetch_add (1, std::memory_order_relaxed);
+    ///             @endcode
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    struct Z4GE_CACHELINE_ALIGNED CachePadded {
+        T Value;
+
+#if Z4GE_HAS_VARIADIC_TEMPLATES && Z4GE_HAS_RVALUE_REFERENCES
+        CachePadded (void) : Value () {}
+
+        /// @brief  Constructs the value in place from @p Values. Never selected for copying another `CachePadded`
+        template<typename First,
+                 typename... Rest,
+                 typename = typename std::enable_if<!std::is_same<typename std::decay<First>::type, CachePadded>::value>::type>
+        explicit CachePadded (First&& Initial, Rest&&... Values)
+          : Value (std::forward<First> (Initial), std::forward<Rest> (Values)...) {}
+#else
+        CachePadded (void) : Value () {}
+        explicit CachePadded (const T& Initial) : Value (Initial) {}
+#endif
+
+        T&       Get (void) Z4GE_NOEXCEPT { return Value; }
+        const T& Get (void) const Z4GE_NOEXCEPT { return Value; }
+
+        T&       operator* (void) Z4GE_NOEXCEPT { return Value; }
+        const T& operator* (void) const Z4GE_NOEXCEPT { return Value; }
+        T*       operator->(void) Z4GE_NOEXCEPT { return &Value; }
+        const T* operator->(void) const Z4GE_NOEXCEPT { return &Value; }
+    };
+
+} // namespace Z4GE
+
+/// @}
+
+#endif
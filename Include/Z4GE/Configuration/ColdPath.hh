@@ -0,0 +1,84 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__COLD_PATH_HH_
+#define Z4GE_CONFIGURATION__COLD_PATH_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/ColdPath.hh
+/// @brief      Outlining of cold blocks with @ref Z4GE_COLD_PATH
+/// @details    This header is not included by Z4GE/Configuration.hh; the sources that use @ref Z4GE_COLD_PATH include it
+///             themselves, so that the other consumers of Z4GE/Configuration/CompilerTraits.hh do not pull in its helper.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Outlines the following block into a cold function
+/// @details    This macro moves the block that follows it out of the enclosing function into a separate, never inlined,
+///             cold function (see @ref Z4GE_COLD), leaving only a call at the original site. It is meant for the error
+///             handling branches of hot functions, which would otherwise be laid out in the middle of the hot code.
+///             @code
+///                 if (Z4GE_UNLIKELY (Status != 0)) {
+///                     Z4GE_COLD_PATH { std::fprintf (stderr, "Request failed with status %d\n", Status); };
+///                     return false;
+///                 }
+///             @endcode
+///             The block is the body of a lambda expression capturing by reference, thus it must be followed by a semicolon
+///             and a `return` statement within it leaves the block only. If lambda expressions are not supported (see
+///             @ref Z4GE_HAS_LAMBDA_EXPRESSIONS), this macro expands to nothing and the block is executed in place.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_COLD_PATH
+#    if defined(__cplusplus) && Z4GE_HAS_LAMBDA_EXPRESSIONS && Z4GE_HAS_RVALUE_REFERENCES
+#        define Z4GE_COLD_PATH ::Z4GE::Detail::ColdPath () + [&] ()
+#    else
+#        define Z4GE_COLD_PATH
+#    endif
+#endif
+
+#if defined(__cplusplus) && Z4GE_HAS_LAMBDA_EXPRESSIONS && Z4GE_HAS_RVALUE_REFERENCES
+
+namespace Z4GE { namespace Detail {
+
+    /// @brief  Implementation of @ref Z4GE_COLD_PATH, which calls the block through a cold function that is never inlined
+    struct ColdPath {
+        template<typename Function>
+#    if Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC)
+        __attribute__ ((__noinline__, __cold__))
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+        __declspec(noinline)
+#    endif
+        void operator+ (Function&& Block) const {
+            Block ();
+        }
+    };
+
+}} // namespace Z4GE::Detail
+
+#endif
+
+/// @}
+
+#endif
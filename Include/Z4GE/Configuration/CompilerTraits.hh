@@ -141,6 +141,50 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      CXX 20 Standard Compliance
+/// @details    This is a conditional compilation flag that represents whether the compiler is configured for CXX 20 standard.
+///             This means that the compiler supports a minimal set of CXX 20 features and can be successfully built under
+///             CXX 20 standard.
+///
+///             A list of conditional compilation flags that represent all the CXX 20 features that are currently taken into
+///             account by the Z4GE.Configuration project are
+///                 -#  @ref Z4GE_HAS_CONSTEVAL
+///                 -#  @ref Z4GE_HAS_CONSTINIT
+///                 -#  @ref Z4GE_HAS_LIKELY_ATTRIBUTE
+///                 -#  @ref Z4GE_HAS_NO_UNIQUE_ADDRESS_ATTRIBUTE
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CXX20_STANDARD_COMPLIANT
+#    if defined(__cplusplus) && __cplusplus >= 202002L
+#        define Z4GE_CXX20_STANDARD_COMPLIANT Z4GE_ENABLE
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC && defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L)
+#        define Z4GE_CXX20_STANDARD_COMPLIANT Z4GE_ENABLE
+#    else
+#        define Z4GE_CXX20_STANDARD_COMPLIANT Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      CXX 23 Standard Compliance
+/// @details    This is a conditional compilation flag that represents whether the compiler is configured for CXX 23 standard.
+///             This means that the compiler supports a minimal set of CXX 23 features and can be successfully built under
+///             CXX 23 standard. Compilers configured for a draft of the standard (eg. `-std=c++2b`, `/std:c++latest`) are
+///             taken into account as well, since they report a value between the CXX 20 and the CXX 23 ones.
+///
+///             A list of conditional compilation flags that represent all the CXX 23 features that are currently taken into
+///             account by the Z4GE.Configuration project are
+///                 -#  @ref Z4GE_HAS_ASSUME_ATTRIBUTE
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CXX23_STANDARD_COMPLIANT
+#    if defined(__cplusplus) && __cplusplus > 202002L
+#        define Z4GE_CXX23_STANDARD_COMPLIANT Z4GE_ENABLE
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC && defined(_MSVC_LANG) && (_MSVC_LANG > 202002L)
+#        define Z4GE_CXX23_STANDARD_COMPLIANT Z4GE_ENABLE
+#    else
+#        define Z4GE_CXX23_STANDARD_COMPLIANT Z4GE_DISABLE
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Checks whether a given CXX attribute is supported by the compiler
 /// @details    This macro makes use of the `__has_attribute` compiler macro to determine whether a given CXX attribute is
@@ -158,6 +202,23 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Checks whether a given standard CXX attribute is supported by the compiler
+/// @details    This macro makes use of the `__has_cpp_attribute` compiler macro to determine whether a given standard (or
+///             vendor scoped, eg. `clang::`) CXX attribute is supported by the host compiler. If the compiler does not have
+///             `__has_cpp_attribute` then this macro plainly evaluates to 0.
+/// @param[in]  __ATTRIBUTE__   The CXX attribute
+/// @return     The date (`YYYYMM`) of the revision of the attribute that is supported by the compiler
+///             0 otherwise
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HAS_CPP_ATTRIBUTE
+#    if defined(__has_cpp_attribute)
+#        define Z4GE_HAS_CPP_ATTRIBUTE(__ATTRIBUTE__) __has_cpp_attribute (__ATTRIBUTE__)
+#    else
+#        define Z4GE_HAS_CPP_ATTRIBUTE(__ATTRIBUTE__) 0
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Checks whether a given CXX compiler builtin function is supported
 /// @details    This macro makes use of the `__has_builtin` compiler macro to determine whether a given CXX CXX compiler builtin
@@ -1485,6 +1546,138 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the CXX 20 `consteval` specifier is supported by the compiler
+/// @details    This conditional compilation flag is set based on whether immediate functions, which are evaluated at compile
+///             time on every call, are supported by the host compiler. The conditional compilation flag is set under one of
+///             the following circumstances
+///                 -#  `__cpp_consteval` is defined to 201811 or higher
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HAS_CONSTEVAL
+#    if defined(__cpp_consteval) && __cpp_consteval >= 201811L
+#        define Z4GE_HAS_CONSTEVAL Z4GE_ENABLE
+#    else
+#        define Z4GE_HAS_CONSTEVAL Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the CXX 20 `constinit` specifier is supported by the compiler
+/// @details    This conditional compilation flag is set based on whether variables with static or thread storage duration can
+///             be required to be constant initialized, which removes the dynamic initialization (and the guard variable
+///             checked on every access of a `thread_local` or a function-local `static`). The conditional compilation flag
+///             is set under one of the following circumstances
+///                 -#  `__cpp_constinit` is defined to 201907 or higher
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HAS_CONSTINIT
+#    if defined(__cpp_constinit) && __cpp_constinit >= 201907L
+#        define Z4GE_HAS_CONSTINIT Z4GE_ENABLE
+#    else
+#        define Z4GE_HAS_CONSTINIT Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the CXX 20 [[likely]] and [[unlikely]] attributes are supported by the compiler
+/// @details    This conditional compilation flag is set based on whether the [[likely]] and [[unlikely]] statement attributes
+///             are supported by the host compiler. The conditional compilation flag is set under one of the following
+///             circumstances
+///                 -#  CXX 20 standard is satisfied ( @ref Z4GE_CXX20_STANDARD_COMPLIANT is set ) and
+///                     `__has_cpp_attribute(likely)` evaluates to 201803 or higher
+///                 -#  Microsoft Visual C++ Version 1926 or higher with CXX 20 standard satisfied
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HAS_LIKELY_ATTRIBUTE
+#    if Z4GE_CXX20_STANDARD_COMPLIANT && Z4GE_HAS_CPP_ATTRIBUTE(likely) >= 201803L
+#        define Z4GE_HAS_LIKELY_ATTRIBUTE Z4GE_ENABLE
+#    elif Z4GE_CXX20_STANDARD_COMPLIANT && Z4GE_COMPILER & Z4GE_COMPILER_MSVC && Z4GE_COMPILER_VERSION >= 192600000
+#        define Z4GE_HAS_LIKELY_ATTRIBUTE Z4GE_ENABLE
+#    else
+#        define Z4GE_HAS_LIKELY_ATTRIBUTE Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the CXX 20 [[no_unique_address]] attribute is supported by the compiler
+/// @details    This conditional compilation flag is set based on whether a non-static data member can share its address with
+///             other members, which lets empty members (eg. stateless allocators, hashers, comparators) occupy no storage.
+///             The conditional compilation flag is set under one of the following circumstances
+///                 -#  CXX 20 standard is satisfied ( @ref Z4GE_CXX20_STANDARD_COMPLIANT is set ) and
+///                     `__has_cpp_attribute(no_unique_address)` evaluates to 201803 or higher
+/// @note       Microsoft Visual C++ accepts but ignores the standard attribute for ABI compatibility, thus this flag is not
+///             set for it. @ref Z4GE_NO_UNIQUE_ADDRESS uses the `[[msvc::no_unique_address]]` extension instead.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HAS_NO_UNIQUE_ADDRESS_ATTRIBUTE
+#    if Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+#        define Z4GE_HAS_NO_UNIQUE_ADDRESS_ATTRIBUTE Z4GE_DISABLE
+#    elif Z4GE_CXX20_STANDARD_COMPLIANT && Z4GE_HAS_CPP_ATTRIBUTE(no_unique_address) >= 201803L
+#        define Z4GE_HAS_NO_UNIQUE_ADDRESS_ATTRIBUTE Z4GE_ENABLE
+#    else
+#        define Z4GE_HAS_NO_UNIQUE_ADDRESS_ATTRIBUTE Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the CXX 23 [[assume]] attribute is supported by the compiler
+/// @details    This conditional compilation flag is set based on whether the [[assume]] statement attribute is supported by
+///             the host compiler. The conditional compilation flag is set under one of the following circumstances
+///                 -#  CXX 23 standard is satisfied ( @ref Z4GE_CXX23_STANDARD_COMPLIANT is set ) and
+///                     `__has_cpp_attribute(assume)` evaluates to 202207 or higher
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HAS_ASSUME_ATTRIBUTE
+#    if Z4GE_CXX23_STANDARD_COMPLIANT && Z4GE_HAS_CPP_ATTRIBUTE(assume) >= 202207L
+#        define Z4GE_HAS_ASSUME_ATTRIBUTE Z4GE_ENABLE
+#    else
+#        define Z4GE_HAS_ASSUME_ATTRIBUTE Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the GNU `target` function attribute is supported by the compiler
+/// @details    This conditional compilation flag is set based on whether a single function can be compiled for an instruction
+///             set other than the one selected for the translation unit (eg. an AVX2 kernel within a baseline x86-64 build).
+///             The conditional compilation flag is set under one of the following circumstances
+///                 -#  GCC, LLVM Clang or Apple Clang and `__has_attribute(target)` evaluates to 1
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HAS_TARGET_ATTRIBUTE
+#    if Z4GE_COMPILER & (Z4GE_COMPILER_GCC | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_APPLE_CLANG) && Z4GE_HAS_ATTRIBUTE(target)
+#        define Z4GE_HAS_TARGET_ATTRIBUTE Z4GE_ENABLE
+#    else
+#        define Z4GE_HAS_TARGET_ATTRIBUTE Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether GNU indirect functions (`ifunc`) are supported by the compiler and the platform
+/// @details    This conditional compilation flag is set based on whether a symbol can be bound by the dynamic loader to the
+///             implementation returned by a resolver function. The resolver runs once, at load time, and calls through the
+///             symbol afterwards cost the same as an ordinary call through the PLT. The conditional compilation flag is set
+///             under one of the following circumstances
+///                 -#  GCC or LLVM Clang targetting an ELF Linux platform and `__has_attribute(ifunc)` evaluates to 1
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HAS_IFUNC_ATTRIBUTE
+#    if Z4GE_COMPILER & (Z4GE_COMPILER_GCC | Z4GE_COMPILER_LLVM_CLANG) && Z4GE_PLATFORM & Z4GE_PLATFORM_LINUX &&               \
+        defined(__ELF__) && Z4GE_HAS_ATTRIBUTE(ifunc)
+#        define Z4GE_HAS_IFUNC_ATTRIBUTE Z4GE_ENABLE
+#    else
+#        define Z4GE_HAS_IFUNC_ATTRIBUTE Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the GNU `target_clones` function attribute is supported by the compiler
+/// @details    This conditional compilation flag is set based on whether the compiler can emit several copies of a function,
+///             each compiled for a different instruction set, along with an `ifunc` resolver that selects the best copy at
+///             load time. The conditional compilation flag is set under one of the following circumstances
+///                 -#  @ref Z4GE_HAS_IFUNC_ATTRIBUTE is set and `__has_attribute(target_clones)` evaluates to 1
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HAS_TARGET_CLONES_ATTRIBUTE
+#    if Z4GE_HAS_IFUNC_ATTRIBUTE && Z4GE_HAS_ATTRIBUTE(target_clones)
+#        define Z4GE_HAS_TARGET_CLONES_ATTRIBUTE Z4GE_ENABLE
+#    else
+#        define Z4GE_HAS_TARGET_CLONES_ATTRIBUTE Z4GE_DISABLE
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @}
 /// @defgroup   cxx_compiler_features_implementation    CXX Compiler Feature Implementation
@@ -1501,28 +1694,47 @@
 ///                 -#  @ref Z4GE_API
 ///                 -#  @ref Z4GE_API_EXPORT
 ///                 -#  @ref Z4GE_API_IMPORT
+///                 -#  @ref Z4GE_ASSUME_ATTR
+///                 -#  @ref Z4GE_COLD
+///                 -#  @ref Z4GE_CONSTEVAL
 ///                 -#  @ref Z4GE_CONSTEXPR
+///                 -#  @ref Z4GE_CONSTEXPR14
+///                 -#  @ref Z4GE_CONSTEXPR17
+///                 -#  @ref Z4GE_CONSTEXPR20
 ///                 -#  @ref Z4GE_CONSTEXPR_OR_CONST
+///                 -#  @ref Z4GE_CONSTINIT
 ///                 -#  @ref Z4GE_CURRENT_FUNCTION
 ///                 -#  @ref Z4GE_DEPRECATED
 ///                 -#  @ref Z4GE_DEPRECATED_MESSAGE
 ///                 -#  @ref Z4GE_EXPLICIT
 ///                 -#  @ref Z4GE_EXTERN_TEMPLATE
 ///                 -#  @ref Z4GE_FINAL
+///                 -#  @ref Z4GE_FLATTEN
+///                 -#  @ref Z4GE_HOT
 ///                 -#  @ref Z4GE_IF_CONSTEXPR
+///                 -#  @ref Z4GE_IFUNC
 ///                 -#  @ref Z4GE_INLINE
 ///                 -#  @ref Z4GE_NOEXCEPT
 ///                 -#  @ref Z4GE_NOINLINE
 ///                 -#  @ref Z4GE_NORETURN
+///                 -#  @ref Z4GE_NO_UNIQUE_ADDRESS
 ///                 -#  @ref Z4GE_LIKELY
+///                 -#  @ref Z4GE_LIKELY_ATTR
 ///                 -#  @ref Z4GE_OFFSET_OF
 ///                 -#  @ref Z4GE_OVERRIDE
 ///                 -#  @ref Z4GE_PACKED
 ///                 -#  @ref Z4GE_PRAGMA
 ///                 -#  @ref Z4GE_RESTRICT
+///                 -#  @ref Z4GE_RESTRICT_RETURN
+///                 -#  @ref Z4GE_SECTION
 ///                 -#  @ref Z4GE_SIZEOF_MEMBER
 ///                 -#  @ref Z4GE_STATIC_ASSERT
+///                 -#  @ref Z4GE_TARGET
+///                 -#  @ref Z4GE_TARGET_CLONES
+///                 -#  @ref Z4GE_UNAUDITED_LIKELY
+///                 -#  @ref Z4GE_UNAUDITED_UNLIKELY
 ///                 -#  @ref Z4GE_UNLIKELY
+///                 -#  @ref Z4GE_UNLIKELY_ATTR
 ///                 -#  @ref Z4GE_UNUSED
 /// @{
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1677,6 +1889,64 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler / Language standard independent CXX 23 [[assume]] attribute
+/// @details    This macro expands to a compiler / language standard independent statement that tells the optimizer that
+///             @p __EXPRESSION__ evaluates to true at this point of the program. Unlike @ref Z4GE_ASSUME, the expression is
+///             never evaluated, thus it may call functions that are not inlined without any runtime cost. It must be used
+///             as a statement, followed by a semicolon, and expands to an empty statement on compilers without such hint.
+/// @param      __EXPRESSION__  A side effect free boolean expression
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_ASSUME_ATTR
+#    if Z4GE_HAS_ASSUME_ATTRIBUTE
+#        define Z4GE_ASSUME_ATTR(__EXPRESSION__) [[assume (__EXPRESSION__)]]
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_GCC && Z4GE_COMPILER_VERSION >= 130000
+#        define Z4GE_ASSUME_ATTR(__EXPRESSION__) __attribute__ ((__assume__ (__EXPRESSION__)))
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG) && Z4GE_HAS_BUILTIN(__builtin_assume)
+#        define Z4GE_ASSUME_ATTR(__EXPRESSION__) __builtin_assume (__EXPRESSION__)
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_MSVC | Z4GE_COMPILER_INTEL)
+#        define Z4GE_ASSUME_ATTR(__EXPRESSION__) __assume (__EXPRESSION__)
+#    else
+#        define Z4GE_ASSUME_ATTR(__EXPRESSION__)
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent hint that a function is rarely executed
+/// @details    This macro expands to a compiler independent attribute that marks a function as unlikely to be executed (eg.
+///             error handling, logging). Such functions are optimized for size, are not inlined into their callers, and are
+///             placed in a separate text section (`.text.unlikely`) so that they do not occupy the instruction cache and the
+///             instruction TLB entries of the hot code. Branches leading to calls of such functions are also predicted as not
+///             taken. Microsoft Visual C++ has no equivalent, thus the function is only kept out of line there.
+/// @see        Z4GE_COLD_PATH
+/// @see        Z4GE_HOT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_COLD
+#    if Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC)
+#        define Z4GE_COLD __attribute__ ((__cold__))
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+#        define Z4GE_COLD __declspec(noinline)
+#    else
+#        define Z4GE_COLD
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler / Language standard independent `consteval` specifier
+/// @details    This macro expands to the immediate function specifier (`consteval`) if it is supported by the host compiler
+///             (see @ref Z4GE_HAS_CONSTEVAL), which guarantees that every call is evaluated at compile time. Otherwise, it
+///             falls back to `constexpr`, which leaves the calls that are not constant expressions to runtime.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CONSTEVAL
+#    if Z4GE_HAS_CONSTEVAL
+#        define Z4GE_CONSTEVAL consteval
+#    elif Z4GE_HAS_CONSTEXPR
+#        define Z4GE_CONSTEVAL constexpr
+#    else
+#        define Z4GE_CONSTEVAL
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Compiler / Language standard independent `constexpr`
 /// @details    This macro expands to the constant expressions declaration (`constexpr`) that is supported
@@ -1746,6 +2016,90 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler / Language standard independent `constexpr` under the CXX 14 rules
+/// @details    This macro expands to `constexpr` if the host compiler implements the relaxed constant expression rules of
+///             CXX 14 (`__cpp_constexpr >= 201304L`). Otherwise, it expands to nothing and the function is evaluated at
+///             runtime. Unlike @ref Z4GE_CONSTEXPR, whose functions are restricted to a single `return` statement, the body
+///             of a `Z4GE_CONSTEXPR14` function may contain:
+///                 -#  Local variables of literal type, which are initialized at their declaration
+///                 -#  `if`, `switch`, `for`, `while` and `do` statements
+///                 -#  Mutation of objects whose lifetime began within the constant evaluation
+///             The member functions marked with `Z4GE_CONSTEXPR14` are also no longer implicitly `const`.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CONSTEXPR14
+#    if defined(__cpp_constexpr) && __cpp_constexpr >= 201304L
+#        define Z4GE_CONSTEXPR14 constexpr
+#    elif Z4GE_HAS_CONSTEXPR && Z4GE_CXX14_STANDARD_COMPLIANT && Z4GE_COMPILER & Z4GE_COMPILER_MSVC &&                         \
+        Z4GE_COMPILER_VERSION >= 191000000
+#        define Z4GE_CONSTEXPR14 constexpr
+#    else
+#        define Z4GE_CONSTEXPR14
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler / Language standard independent `constexpr` under the CXX 17 rules
+/// @details    This macro expands to `constexpr` if the host compiler implements the constant expression rules of CXX 17
+///             (`__cpp_constexpr >= 201603L`). Otherwise, it expands to nothing. On top of the rules of
+///             @ref Z4GE_CONSTEXPR14, a `Z4GE_CONSTEXPR17` function may create and invoke lambda expressions.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CONSTEXPR17
+#    if defined(__cpp_constexpr) && __cpp_constexpr >= 201603L
+#        define Z4GE_CONSTEXPR17 constexpr
+#    elif Z4GE_HAS_CONSTEXPR && Z4GE_CXX17_STANDARD_COMPLIANT && Z4GE_COMPILER & Z4GE_COMPILER_MSVC &&                         \
+        Z4GE_COMPILER_VERSION >= 191100000
+#        define Z4GE_CONSTEXPR17 constexpr
+#    else
+#        define Z4GE_CONSTEXPR17
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler / Language standard independent `constexpr` under the CXX 20 rules
+/// @details    This macro expands to `constexpr` if the host compiler implements the constant expression rules of CXX 20
+///             (`__cpp_constexpr >= 201907L`). Otherwise, it expands to nothing. On top of the rules of
+///             @ref Z4GE_CONSTEXPR17, a `Z4GE_CONSTEXPR20` function may:
+///                 -#  Be a virtual function
+///                 -#  Contain a `try` block and an ASM declaration, as long as neither is evaluated
+///                 -#  Declare local variables without initializing them
+///                 -#  Change the active member of a union
+///
+/// @note       The transient allocations with `new` / `delete` (and so `std::vector` / `std::string`) are a separate
+///             feature (`__cpp_constexpr_dynamic_alloc`), which is not implied by this macro.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CONSTEXPR20
+#    if defined(__cpp_constexpr) && __cpp_constexpr >= 201907L
+#        define Z4GE_CONSTEXPR20 constexpr
+#    elif Z4GE_HAS_CONSTEXPR && Z4GE_CXX20_STANDARD_COMPLIANT && Z4GE_COMPILER & Z4GE_COMPILER_MSVC &&                         \
+        Z4GE_COMPILER_VERSION >= 192900000
+#        define Z4GE_CONSTEXPR20 constexpr
+#    else
+#        define Z4GE_CONSTEXPR20
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler / Language standard independent `constinit` specifier
+/// @details    This macro expands to a compiler / language standard independent `constinit` specifier that requires a
+///             variable with static or thread storage duration to be constant initialized. The initialization then happens
+///             at compile time, and the accesses of a `thread_local` variable no longer check a guard variable. Where neither
+///             the standard specifier (see @ref Z4GE_HAS_CONSTINIT) nor a compiler extension is available, this macro
+///             expands to nothing and the variable is constant initialized whenever possible, without a diagnostic.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CONSTINIT
+#    if Z4GE_HAS_CONSTINIT
+#        define Z4GE_CONSTINIT constinit
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_GCC && Z4GE_COMPILER_VERSION >= 100000
+#        define Z4GE_CONSTINIT __constinit
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG) &&                                        \
+        Z4GE_HAS_ATTRIBUTE(__require_constant_initialization__)
+#        define Z4GE_CONSTINIT __attribute__ ((__require_constant_initialization__))
+#    else
+#        define Z4GE_CONSTINIT
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Compiler / Language independent function name macro equivalent to `__FUNCTION__`
 /// @details    This macro expands a compiler / language specific function name macro that can be used in debugging and loading
@@ -1888,6 +2242,37 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent hint to inline every call within a function
+/// @details    This macro expands to a compiler independent attribute that inlines, where possible, every call made from the
+///             body of the function it is applied to, recursively. It is useful for small kernels built out of many trivial
+///             helpers, without marking the helpers themselves as always inlined for every other caller. Microsoft Visual C++
+///             has no equivalent function attribute, thus this macro expands to nothing there.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_FLATTEN
+#    if Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC)
+#        define Z4GE_FLATTEN __attribute__ ((__flatten__))
+#    else
+#        define Z4GE_FLATTEN
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent hint that a function is frequently executed
+/// @details    This macro expands to a compiler independent attribute that marks a function as a hot spot of the program.
+///             Such functions are optimized more aggressively and are grouped together in a separate text section
+///             (`.text.hot`), improving their instruction cache and instruction TLB locality. Microsoft Visual C++ has no
+///             equivalent, profile guided optimization should be used instead, thus this macro expands to nothing there.
+/// @see        Z4GE_COLD
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_HOT
+#    if Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC)
+#        define Z4GE_HOT __attribute__ ((__hot__))
+#    else
+#        define Z4GE_HOT
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Compiler / Language standard independent `constexpr` for `if` statements
 /// @details    This macro expands to the constant expressions declaration (`constexpr`) in an `if` statement that is supported
@@ -1907,6 +2292,22 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler / Platform specific GNU indirect function (`ifunc`) attribute
+/// @details    This macro expands to the `ifunc` attribute that binds the declared function to the implementation returned by
+///             the resolver @p __RESOLVER__ at load time. The resolver must have C linkage. If indirect functions are not
+///             supported (see @ref Z4GE_HAS_IFUNC_ATTRIBUTE), this macro expands to nothing and must not be used; prefer
+///             @ref Z4GE_DISPATCH, which falls back to a function pointer resolved on the first call.
+/// @param[in]  __RESOLVER__    The name of the resolver function
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_IFUNC
+#    if Z4GE_HAS_IFUNC_ATTRIBUTE
+#        define Z4GE_IFUNC(__RESOLVER__) __attribute__ ((ifunc (Z4GE_STRINGIZE (__RESOLVER__))))
+#    else
+#        define Z4GE_IFUNC(__RESOLVER__)
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Compiler / Language standard independent `noinline` hint
 /// @details    This macro is a compiler / language standard independent `inline` specifier. The inline property can be forced
@@ -1929,18 +2330,45 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the branch prediction hints are audited
+/// @details    When this conditional compilation flag is set, @ref Z4GE_LIKELY and @ref Z4GE_UNLIKELY record the outcome of
+///             every evaluation of their expression, and the sites whose hint is contradicted by most of their evaluations
+///             are reported at exit (see @ref Z4GE/Configuration/BranchAudit.hh). It is disabled by default, and can be
+///             enabled through the `Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS` CMake option.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS
+#    define Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS Z4GE_DISABLE
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Compiler independent hint for branch prediction (likely)
 /// @details    This macro expands to a compiler independent hint for branch prediction denoting that the branch is "likely" to
 ///             be executed.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef Z4GE_LIKELY
-#    if Z4GE_COMPILER & Z4GE_COMPILER_GCC && Z4GE_COMPILER_VERSION >= 30000
-#        define Z4GE_LIKELY(__EXPRESSION__) __builtin_expect (!!(__EXPRESSION__), true)
-#    elif Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG) && Z4GE_HAS_BUILTIN(__builtin_expect)
-#        define Z4GE_LIKELY(__EXPRESSION__) __builtin_expect (!!(__EXPRESSION__), true)
+#    if Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS && defined(__cplusplus)
+#        define Z4GE_LIKELY(__EXPRESSION__) Z4GE_BRANCH_AUDIT_RECORD (__EXPRESSION__, true)
+#    else
+#        define Z4GE_LIKELY(__EXPRESSION__) Z4GE_UNAUDITED_LIKELY (__EXPRESSION__)
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler / Language standard independent CXX 20 [[likely]] attribute
+/// @details    This macro expands to the [[likely]] statement attribute if it is supported by the host compiler (see
+///             @ref Z4GE_HAS_LIKELY_ATTRIBUTE), and to nothing otherwise. Unlike @ref Z4GE_LIKELY, it applies to a statement
+///             or a label rather than to an expression, which allows hinting the cases of a `switch` statement.
+///             @code
+///                 if (Index < Size) Z4GE_LIKELY_ATTR { ... }
+///                 switch (Kind) { Z4GE_LIKELY_ATTR case Kind::Common: ... }
+///             @endcode
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_LIKELY_ATTR
+#    if Z4GE_HAS_LIKELY_ATTRIBUTE
+#        define Z4GE_LIKELY_ATTR [[likely]]
 #    else
-#        define Z4GE_LIKELY(__EXPRESSION__) (__EXPRESSION__)
+#        define Z4GE_LIKELY_ATTR
 #    endif
 #endif
 
@@ -2056,6 +2484,23 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler / Language standard independent CXX 20 [[no_unique_address]] attribute
+/// @details    This macro expands to a compiler / language standard independent [[no_unique_address]] attribute that lets a
+///             non-static data member of an empty type (eg. a stateless allocator, hasher or policy) occupy no storage, in
+///             place of the empty base optimization. Microsoft Visual C++ 1929 or higher uses `[[msvc::no_unique_address]]`,
+///             since it ignores the standard attribute for ABI compatibility. Otherwise, this macro expands to nothing.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_NO_UNIQUE_ADDRESS
+#    if Z4GE_HAS_NO_UNIQUE_ADDRESS_ATTRIBUTE
+#        define Z4GE_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC && Z4GE_COMPILER_VERSION >= 192900000 && Z4GE_CXX20_STANDARD_COMPLIANT
+#        define Z4GE_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#    else
+#        define Z4GE_NO_UNIQUE_ADDRESS
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Compiler / Language standard independent `override` specifier.
 /// @details    This macro expands to the `override` member function specifier that is used to override the base classes'
@@ -2087,6 +2532,42 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler Hint for functions returning non-aliased memory
+/// @details    `restrict` qualifiers on a return type are ignored, thus this macro is the equivalent of @ref Z4GE_RESTRICT for
+///             allocation functions. It denotes that the returned pointer does not alias any other pointer that is valid when
+///             the function returns, and precedes the function declaration
+///             @code
+///                 Z4GE_RESTRICT_RETURN void* Allocate (std::size_t Size);
+///             @endcode
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_RESTRICT_RETURN
+#    if Z4GE_COMPILER & Z4GE_COMPILER_MSVC && Z4GE_COMPILER_VERSION >= 140000000
+#        define Z4GE_RESTRICT_RETURN __declspec(restrict)
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC)
+#        define Z4GE_RESTRICT_RETURN __attribute__ ((__malloc__))
+#    else
+#        define Z4GE_RESTRICT_RETURN
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent placement of a function in a named section
+/// @details    This macro expands to a compiler independent attribute that places the function it is applied to in the
+///             section @p __NAME__ of the object file, eg. to group the functions of a request loop on the same pages or to
+///             order them with a linker script. Microsoft Visual C++ places the function in the code segment @p __NAME__.
+/// @param[in]  __NAME__    The name of the section, as a string literal. Mach-O targets require a `"segment,section"` name
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_SECTION
+#    if Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC)
+#        define Z4GE_SECTION(__NAME__) __attribute__ ((__section__ (__NAME__)))
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+#        define Z4GE_SECTION(__NAME__) __declspec(code_seg (__NAME__))
+#    else
+#        define Z4GE_SECTION(__NAME__)
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Compiler / Language Standard independent `static_assert`
 /// @details    The macro expands to a compiler / language standard independent `static_assert` that can be used to include
@@ -2186,18 +2667,90 @@
 #    endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent per-function instruction set selection
+/// @details    This macro expands to the GNU `target` attribute, which compiles a single function for the given instruction
+///             set(s) regardless of the flags used for the rest of the translation unit, eg.
+///             @code
+///                 Z4GE_TARGET ("avx2,fma") float DotProductAVX2 (const float* Lhs, const float* Rhs, size_t Size);
+///             @endcode
+///             Such a function must only be called after checking the executing processor (see
+///             @ref Z4GE::Configuration::GetRuntimeArchitecture "GetRuntimeArchitecture"). If the attribute is not supported
+///             (see @ref Z4GE_HAS_TARGET_ATTRIBUTE), this macro expands to nothing.
+/// @param[in]  ...     The comma separated instruction set string, in the GCC / Clang `target` attribute syntax
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_TARGET
+#    if Z4GE_HAS_TARGET_ATTRIBUTE
+#        define Z4GE_TARGET(...) __attribute__ ((target (__VA_ARGS__)))
+#    else
+#        define Z4GE_TARGET(...)
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent function multiversioning
+/// @details    This macro expands to the GNU `target_clones` attribute, which makes the compiler emit one copy of the function
+///             per listed instruction set, plus an `ifunc` resolver that binds the best copy for the executing processor at
+///             load time, eg.
+///             @code
+///                 Z4GE_TARGET_CLONES ("avx2", "sse4.2", "default") void Scale (float* Data, float Factor, size_t Size);
+///             @endcode
+///             If function multiversioning is not supported (see @ref Z4GE_HAS_TARGET_CLONES_ATTRIBUTE), this macro expands
+///             to nothing and the function is compiled once, for the translation unit's instruction set.
+/// @param[in]  ...     The instruction set strings, one of which must be "default"
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_TARGET_CLONES
+#    if Z4GE_HAS_TARGET_CLONES_ATTRIBUTE
+#        define Z4GE_TARGET_CLONES(...) __attribute__ ((target_clones (__VA_ARGS__)))
+#    else
+#        define Z4GE_TARGET_CLONES(...)
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent hints for branch prediction, which are never audited
+/// @details    These macros are @ref Z4GE_LIKELY and @ref Z4GE_UNLIKELY without the recording of
+///             @ref Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS, whose function-local statics, `thread_local` tables and `atexit`
+///             handler require an initialized runtime. They are meant for the code that runs before it, such as the
+///             `ifunc` resolvers of @ref Z4GE_DISPATCH and the startup architecture guard.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_UNAUDITED_LIKELY
+#    if Z4GE_COMPILER & Z4GE_COMPILER_GCC && Z4GE_COMPILER_VERSION >= 30000
+#        define Z4GE_UNAUDITED_LIKELY(__EXPRESSION__)   __builtin_expect (!!(__EXPRESSION__), true)
+#        define Z4GE_UNAUDITED_UNLIKELY(__EXPRESSION__) __builtin_expect (!!(__EXPRESSION__), false)
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG) && Z4GE_HAS_BUILTIN(__builtin_expect)
+#        define Z4GE_UNAUDITED_LIKELY(__EXPRESSION__)   __builtin_expect (!!(__EXPRESSION__), true)
+#        define Z4GE_UNAUDITED_UNLIKELY(__EXPRESSION__) __builtin_expect (!!(__EXPRESSION__), false)
+#    else
+#        define Z4GE_UNAUDITED_LIKELY(__EXPRESSION__)   (__EXPRESSION__)
+#        define Z4GE_UNAUDITED_UNLIKELY(__EXPRESSION__) (__EXPRESSION__)
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Compiler independent hint for branch prediction (unlikely)
 /// @details    This macro expands to a compiler independent hint for branch prediction denoting that the branch is "unlikely"
 ///             to be executed.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef Z4GE_UNLIKELY
-#    if Z4GE_COMPILER & Z4GE_COMPILER_GCC && Z4GE_COMPILER_VERSION >= 30000
-#        define Z4GE_UNLIKELY(__EXPRESSION__) __builtin_expect (!!(__EXPRESSION__), false)
-#    elif Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG) && Z4GE_HAS_BUILTIN(__builtin_expect)
-#        define Z4GE_UNLIKELY(__EXPRESSION__) __builtin_expect (!!(__EXPRESSION__), false)
+#    if Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS && defined(__cplusplus)
+#        define Z4GE_UNLIKELY(__EXPRESSION__) Z4GE_BRANCH_AUDIT_RECORD (__EXPRESSION__, false)
+#    else
+#        define Z4GE_UNLIKELY(__EXPRESSION__) Z4GE_UNAUDITED_UNLIKELY (__EXPRESSION__)
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler / Language standard independent CXX 20 [[unlikely]] attribute
+/// @details    This macro expands to the [[unlikely]] statement attribute if it is supported by the host compiler (see
+///             @ref Z4GE_HAS_LIKELY_ATTRIBUTE), and to nothing otherwise.
+/// @see        Z4GE_LIKELY_ATTR
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_UNLIKELY_ATTR
+#    if Z4GE_HAS_LIKELY_ATTRIBUTE
+#        define Z4GE_UNLIKELY_ATTR [[unlikely]]
 #    else
-#        define Z4GE_UNLIKELY(__EXPRESSION__) (__EXPRESSION__)
+#        define Z4GE_UNLIKELY_ATTR
 #    endif
 #endif
 
@@ -2228,4 +2781,8 @@
 /// @}
 /// @endcond
 
+#if Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS && defined(__cplusplus)
+#    include <Z4GE/Configuration/BranchAudit.hh>
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,134 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__DISPATCH_HH_
+#define Z4GE_CONFIGURATION__DISPATCH_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/Dispatch.hh
+/// @brief      Runtime Instruction Set Dispatch
+/// @details    This header provides the means to ship several implementations of a kernel, each compiled for a different
+///             instruction set (see @ref Z4GE_TARGET), and to bind the best one for the executing processor exactly once.
+///
+///             Implementations are described by @ref Z4GE::Configuration::DispatchCandidate "DispatchCandidate"s that are
+///             keyed by `Z4GE_ARCHITECTURE_BIT_*` flags and ordered from the most to the least demanding one, the last one
+///             being the baseline implementation, eg.
+///             @code
+///                 static float SumScalar (const float* Data, size_t Size);
+///                 Z4GE_TARGET ("sse4.2") static float SumSSE42 (const float* Data, size_t Size);
+///                 Z4GE_TARGET ("avx2") static float SumAVX2 (const float* Data, size_t Size);
+///
+///                 static float (*SelectSum (void))(const float*, size_t) {
+///                     typedef float (*SumFunction) (const float*, size_t);
+///                     static const Z4GE::Configuration::DispatchCandidate<SumFunction> Candidates[] = {
+///                         { Z4GE_ARCHITECTURE_BIT_AVX2, &SumAVX2 },
+///                         { Z4GE_ARCHITECTURE_BIT_SSE42, &SumSSE42 },
+///                         { Z4GE_ARCHITECTURE_UNKNOWN, &SumScalar },
+///                     };
+///                     return Z4GE::Configuration::SelectImplementation (Candidates);
+///                 }
+///
+///                 Z4GE_DISPATCH (float, Sum, (const float* Data, size_t Size), (Data, Size), SelectSum)
+///             @endcode
+/// @note       Unlike the other Z4GE.Configuration headers, this header is not included by @ref Z4GE/Configuration.hh since
+///             it depends on @ref Z4GE/Configuration/RuntimeArchitecture.hh.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+#include <Z4GE/Configuration/RuntimeArchitecture.hh>
+
+#include <cstddef>
+
+namespace Z4GE { namespace Configuration {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      An implementation of a dispatched kernel
+    /// @tparam     FunctionPointer The function pointer type of the kernel
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename FunctionPointer>
+    struct DispatchCandidate {
+        ArchitectureMask Architecture;   ///!    `Z4GE_ARCHITECTURE_BIT_*` flags required by the implementation
+        FunctionPointer  Implementation; ///!    The implementation
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Select the first implementation that is supported by the executing processor
+    /// @details    The candidates are expected to be ordered from the most to the least demanding implementation. The last
+    ///             candidate is returned if none of them is supported, therefore it should be the baseline implementation
+    ///             (ie. require @ref Z4GE_ARCHITECTURE_UNKNOWN).
+    /// @param[in]  Candidates  The implementations, ordered by preference
+    /// @returns    The selected implementation
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename FunctionPointer, std::size_t Count>
+    inline FunctionPointer SelectImplementation (const DispatchCandidate<FunctionPointer> (&Candidates)[Count]) Z4GE_NOEXCEPT {
+        const ArchitectureMask Architecture = GetRuntimeArchitecture ();
+        for (std::size_t Index = 0; Index < Count; ++Index) {
+            if ((Architecture & Candidates[Index].Architecture) == Candidates[Index].Architecture) {
+                return Candidates[Index].Implementation;
+            }
+        }
+        return Candidates[Count - 1].Implementation;
+    }
+
+}} // namespace Z4GE::Configuration
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Defines a function that forwards to the implementation chosen by a selector
+/// @details    This macro defines the function @p __NAME__ which is bound to the implementation returned by @p __SELECTOR__.
+///             The selector is invoked exactly once:
+///                 -#  If GNU indirect functions are supported (see @ref Z4GE_HAS_IFUNC_ATTRIBUTE), @p __NAME__ is an `ifunc`
+///                     and the selector runs as its resolver, at load time. Calls cost the same as a regular call.
+///                 -#  Otherwise, the selector runs on the first call and its result is cached in a function-local static
+///                     function pointer.
+///             The selector must not depend on dynamically initialized state, since it may run before static constructors.
+///             For the same reason it must not use @ref Z4GE_LIKELY / @ref Z4GE_UNLIKELY, which are recorded by the branch
+///             audit (see @ref Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS); use @ref Z4GE_UNAUDITED_LIKELY instead.
+/// @note       @p __NAME__ must be a non-member, non-template function.
+/// @param[in]  __RETURN__      The return type of the function
+/// @param[in]  __NAME__        The name of the function
+/// @param[in]  __PARAMETERS__  The parenthesized parameter list of the function, eg. `(const float* Data, size_t Size)`
+/// @param[in]  __ARGUMENTS__   The parenthesized argument list forwarded to the implementation, eg. `(Data, Size)`
+/// @param[in]  __SELECTOR__    A function taking no arguments and returning the implementation to be used
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_DISPATCH
+#    if Z4GE_HAS_IFUNC_ATTRIBUTE
+#        define Z4GE_DISPATCH(__RETURN__, __NAME__, __PARAMETERS__, __ARGUMENTS__, __SELECTOR__)                               \
+            __RETURN__ __NAME__ __PARAMETERS__;                                                                                \
+            extern "C" {                                                                                                       \
+                static decltype (&__NAME__) __NAME__##_Z4GEResolver (void) { return __SELECTOR__ (); }                         \
+            }                                                                                                                  \
+            __RETURN__ __NAME__ __PARAMETERS__ Z4GE_IFUNC (__NAME__##_Z4GEResolver);
+#    else
+#        define Z4GE_DISPATCH(__RETURN__, __NAME__, __PARAMETERS__, __ARGUMENTS__, __SELECTOR__)                               \
+            __RETURN__ __NAME__ __PARAMETERS__ {                                                                               \
+                static const decltype (&__NAME__) Implementation = __SELECTOR__ ();                                            \
+                return Implementation __ARGUMENTS__;                                                                           \
+            }
+#    endif
+#endif
+
+/// @}
+
+#endif
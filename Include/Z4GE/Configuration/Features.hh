@@ -0,0 +1,391 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__FEATURES_HH_
+#define Z4GE_CONFIGURATION__FEATURES_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/Features.hh
+/// @brief      Compile-time Feature Set
+/// @details    The configuration macros can only be tested by the preprocessor, which cannot reach into templates. This
+///             header mirrors every `Z4GE_HAS_*` flag, @ref Z4GE_ARCHITECTURE and its `Z4GE_ARCHITECTURE_BIT_*` flags, the
+///             x86-64 microarchitecture levels, @ref Z4GE_BUILD_MODEL and the C++ standard level as constant members of
+///             @ref Z4GE::Configuration::Features "Features", so that generic code selects its implementation at compile
+///             time, eg.
+///             @code
+///                 template<typename Type>
+///                 Type Sum (const Type* Data, std::size_t Size) {
+///                     Z4GE_IF_CONSTEXPR (Z4GE::Configuration::Features::HasAVX2 && sizeof (Type) == 4) {
+///                         return SumAVX2 (Data, Size);
+///                     }
+///                     return SumScalar (Data, Size);
+///                 }
+///
+///                 float Dot (const float* Left, const float* Right, std::size_t Size) {
+///                     return DotImplementation (Left, Right, Size,
+///                                               std::integral_constant<bool, Z4GE::Configuration::Features::HasFMA> ());
+///                 }
+///             @endcode
+/// @note       Unlike the other Z4GE.Configuration headers, this header is not included by @ref Z4GE/Configuration.hh, which
+///             only declares macros.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/Assume.hh>
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <cstdint>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      The highest C++ standard the translation unit complies with, eg. `17`, `3` for C++03
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_CXX_STANDARD_LEVEL
+#    if Z4GE_CXX23_STANDARD_COMPLIANT
+#        define Z4GE_CXX_STANDARD_LEVEL 23
+#    elif Z4GE_CXX20_STANDARD_COMPLIANT
+#        define Z4GE_CXX_STANDARD_LEVEL 20
+#    elif Z4GE_CXX17_STANDARD_COMPLIANT
+#        define Z4GE_CXX_STANDARD_LEVEL 17
+#    elif Z4GE_CXX14_STANDARD_COMPLIANT
+#        define Z4GE_CXX_STANDARD_LEVEL 14
+#    elif Z4GE_CXX11_STANDARD_COMPLIANT
+#        define Z4GE_CXX_STANDARD_LEVEL 11
+#    else
+#        define Z4GE_CXX_STANDARD_LEVEL 3
+#    endif
+#endif
+
+namespace Z4GE { namespace Configuration {
+
+    namespace Detail {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      The feature set of the translation unit
+        /// @details    The members of a class template can be defined in a header, therefore they can be odr-used (eg. bound
+        ///             to a reference) before C++17 as well.
+        /// @tparam     Tag Unused
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename Tag = void>
+        struct FeatureSet {
+            //  Compiler, language and build model
+            static Z4GE_CONSTEXPR_OR_CONST std::uint32_t Compiler = Z4GE_COMPILER;
+            static Z4GE_CONSTEXPR_OR_CONST std::uint32_t CompilerVersion = Z4GE_COMPILER_VERSION;
+            static Z4GE_CONSTEXPR_OR_CONST unsigned Standard = Z4GE_CXX_STANDARD_LEVEL;
+            static Z4GE_CONSTEXPR_OR_CONST std::uint32_t BuildModel = Z4GE_BUILD_MODEL;
+            static Z4GE_CONSTEXPR_OR_CONST bool Is64Bit = Z4GE_BUILD_MODEL == Z4GE_BUILD_MODEL_64;
+
+            //  Z4GE_HAS_* flags, eg. HasIfConstexpr mirrors Z4GE_HAS_IF_CONSTEXPR
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAlignedNew = Z4GE_HAS_ALIGNED_NEW != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAlignAs = Z4GE_HAS_ALIGN_AS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAlignOf = Z4GE_HAS_ALIGN_OF != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAssumeAttribute = Z4GE_HAS_ASSUME_ATTRIBUTE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAuto = Z4GE_HAS_AUTO != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasConsteval = Z4GE_HAS_CONSTEVAL != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasConstexpr = Z4GE_HAS_CONSTEXPR != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasConstinit = Z4GE_HAS_CONSTINIT != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasDecltype = Z4GE_HAS_DECLTYPE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasDefaultedFunctions = Z4GE_HAS_DEFAULTED_FUNCTIONS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasDefaultFunctionTemplateArguments =
+                Z4GE_HAS_DEFAULT_FUNCTION_TEMPLATE_ARGUMENTS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasDelegatingConstructors = Z4GE_HAS_DELEGATING_CONSTRUCTORS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasDeletedFunctions = Z4GE_HAS_DELETED_FUNCTIONS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasExplicitConversionOperators = Z4GE_HAS_EXPLICIT_CONVERSION_OPERATORS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasExtendedFriendDeclarations = Z4GE_HAS_EXTENDED_FRIEND_DECLARATIONS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasExtendedSizeof = Z4GE_HAS_EXTENDED_SIZEOF != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasExternTemplates = Z4GE_HAS_EXTERN_TEMPLATES != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasFallthroughAttribute = Z4GE_HAS_FALLTHROUGH_ATTRIBUTE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasForwardDeclaredEnums = Z4GE_HAS_FORWARD_DECLARED_ENUMS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasIfuncAttribute = Z4GE_HAS_IFUNC_ATTRIBUTE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasIfConstexpr = Z4GE_HAS_IF_CONSTEXPR != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasInheritanceFinal = Z4GE_HAS_INHERITANCE_FINAL != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasInheritingConstructors = Z4GE_HAS_INHERITING_CONSTRUCTORS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasInitializerLists = Z4GE_HAS_INITIALIZER_LISTS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasInlineNamespaces = Z4GE_HAS_INLINE_NAMESPACES != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasLambdaExpressions = Z4GE_HAS_LAMBDA_EXPRESSIONS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasLikelyAttribute = Z4GE_HAS_LIKELY_ATTRIBUTE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasLocalClassTemplateParameters = Z4GE_HAS_LOCAL_CLASS_TEMPLATE_PARAMETERS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasMaybeUnusedAttribute = Z4GE_HAS_MAYBE_UNUSED_ATTRIBUTE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasNodiscardAttribute = Z4GE_HAS_NODISCARD_ATTRIBUTE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasNoexcept = Z4GE_HAS_NOEXCEPT != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasNonstaticMemberInitializers = Z4GE_HAS_NONSTATIC_MEMBER_INITIALIZERS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasNoreturn = Z4GE_HAS_NORETURN != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasNoUniqueAddressAttribute = Z4GE_HAS_NO_UNIQUE_ADDRESS_ATTRIBUTE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasNullptr = Z4GE_HAS_NULLPTR != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasOverride = Z4GE_HAS_OVERRIDE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasPodRelaxation = Z4GE_HAS_POD_RELAXATION != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasRangeBasedForLoops = Z4GE_HAS_RANGE_BASED_FOR_LOOPS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasRawLiterals = Z4GE_HAS_RAW_LITERALS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasRightAngledBrackets = Z4GE_HAS_RIGHT_ANGLED_BRACKETS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasRvalueReferences = Z4GE_HAS_RVALUE_REFERENCES != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasStaticAssert = Z4GE_HAS_STATIC_ASSERT != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasStdAssumeAligned = Z4GE_HAS_STD_ASSUME_ALIGNED != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasStronglyTypedEnums = Z4GE_HAS_STRONGLY_TYPED_ENUMS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasTargetAttribute = Z4GE_HAS_TARGET_ATTRIBUTE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasTargetClonesAttribute = Z4GE_HAS_TARGET_CLONES_ATTRIBUTE != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasTemplateAliases = Z4GE_HAS_TEMPLATE_ALIASES != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasTrailingReturnTypes = Z4GE_HAS_TRAILING_RETURN_TYPES != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasUnicodeStringLiterals = Z4GE_HAS_UNICODE_STRING_LITERALS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasUniformInitializationSyntax = Z4GE_HAS_UNIFORM_INITIALIZATION_SYNTAX != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasUnrestrictedUnions = Z4GE_HAS_UNRESTRICTED_UNIONS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasUserLiterals = Z4GE_HAS_USER_LITERALS != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasVariableTemplates = Z4GE_HAS_VARIABLE_TEMPLATES != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasVariadicTemplates = Z4GE_HAS_VARIADIC_TEMPLATES != 0;
+
+            //  Z4GE_ARCHITECTURE and its Z4GE_ARCHITECTURE_BIT_* flags, eg. HasAVX2 mirrors Z4GE_ARCHITECTURE_BIT_AVX2
+            static Z4GE_CONSTEXPR_OR_CONST std::uint32_t Architecture = Z4GE_ARCHITECTURE;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasX86 = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_X86) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasSSE = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasSSE2 = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE2) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasSSE3 = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE3) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasSSSE3 = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSSE3) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasSSE41 = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE41) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasSSE42 = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE42) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAVX = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAVX2 = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX2) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasPOPCNT = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_POPCNT) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasLZCNT = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_LZCNT) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasBMI1 = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_BMI1) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasBMI2 = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_BMI2) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasF16C = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_F16C) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasFMA = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_FMA) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAVX512F = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX512F) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAVX512CD = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX512CD) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAVX512BW = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX512BW) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAVX512DQ = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX512DQ) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAVX512VL = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX512VL) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasAVX512VNNI = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX512VNNI) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasARM = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_ARM) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasNEON = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_NEON) != 0;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasARMV8 = (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_ARMV8) != 0;
+
+            //  x86-64 microarchitecture levels, eg. HasX86_64_V3 requires every flag of Z4GE_ARCHITECTURE_X86_64_V3
+            static Z4GE_CONSTEXPR_OR_CONST bool HasX86_64_V1 =
+                (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_X86_64_V1) == Z4GE_ARCHITECTURE_X86_64_V1;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasX86_64_V2 =
+                (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_X86_64_V2) == Z4GE_ARCHITECTURE_X86_64_V2;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasX86_64_V3 =
+                (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_X86_64_V3) == Z4GE_ARCHITECTURE_X86_64_V3;
+            static Z4GE_CONSTEXPR_OR_CONST bool HasX86_64_V4 =
+                (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_X86_64_V4) == Z4GE_ARCHITECTURE_X86_64_V4;
+
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief      Whether @ref Z4GE_ARCHITECTURE includes every `Z4GE_ARCHITECTURE_BIT_*` flag of @p Required
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static Z4GE_CONSTEXPR bool HasArchitecture (std::uint32_t Required) Z4GE_NOEXCEPT {
+                return (Z4GE_ARCHITECTURE & Required) == Required;
+            }
+        };
+
+        //  Static constexpr data members are implicitly inline since C++17, and their redeclaration is deprecated
+#if !Z4GE_CXX17_STANDARD_COMPLIANT
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST std::uint32_t FeatureSet<Tag>::Compiler;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST std::uint32_t FeatureSet<Tag>::CompilerVersion;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST unsigned FeatureSet<Tag>::Standard;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST std::uint32_t FeatureSet<Tag>::BuildModel;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::Is64Bit;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAlignedNew;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAlignAs;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAlignOf;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAssumeAttribute;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAuto;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasConsteval;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasConstexpr;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasConstinit;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasDecltype;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasDefaultedFunctions;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasDefaultFunctionTemplateArguments;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasDelegatingConstructors;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasDeletedFunctions;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasExplicitConversionOperators;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasExtendedFriendDeclarations;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasExtendedSizeof;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasExternTemplates;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasFallthroughAttribute;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasForwardDeclaredEnums;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasIfuncAttribute;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasIfConstexpr;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasInheritanceFinal;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasInheritingConstructors;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasInitializerLists;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasInlineNamespaces;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasLambdaExpressions;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasLikelyAttribute;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasLocalClassTemplateParameters;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasMaybeUnusedAttribute;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasNodiscardAttribute;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasNoexcept;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasNonstaticMemberInitializers;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasNoreturn;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasNoUniqueAddressAttribute;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasNullptr;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasOverride;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasPodRelaxation;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasRangeBasedForLoops;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasRawLiterals;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasRightAngledBrackets;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasRvalueReferences;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasStaticAssert;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasStdAssumeAligned;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasStronglyTypedEnums;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasTargetAttribute;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasTargetClonesAttribute;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasTemplateAliases;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasTrailingReturnTypes;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasUnicodeStringLiterals;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasUniformInitializationSyntax;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasUnrestrictedUnions;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasUserLiterals;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasVariableTemplates;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasVariadicTemplates;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST std::uint32_t FeatureSet<Tag>::Architecture;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasX86;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasSSE;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasSSE2;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasSSE3;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasSSSE3;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasSSE41;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasSSE42;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAVX;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAVX2;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasPOPCNT;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasLZCNT;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasBMI1;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasBMI2;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasF16C;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasFMA;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAVX512F;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAVX512CD;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAVX512BW;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAVX512DQ;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAVX512VL;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasAVX512VNNI;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasARM;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasNEON;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasARMV8;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasX86_64_V1;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasX86_64_V2;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasX86_64_V3;
+        template<typename Tag>
+        Z4GE_CONSTEXPR_OR_CONST bool FeatureSet<Tag>::HasX86_64_V4;
+#endif
+
+    } // namespace Detail
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      The compile-time feature set of the translation unit
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    typedef Detail::FeatureSet<> Features;
+
+}} // namespace Z4GE::Configuration
+
+/// @}
+
+#endif
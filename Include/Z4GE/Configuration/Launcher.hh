@@ -0,0 +1,190 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__LAUNCHER_HH_
+#define Z4GE_CONFIGURATION__LAUNCHER_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/Launcher.hh
+/// @brief      Multi Instruction Set Executable Launcher
+/// @details    This header implements the launcher of the executables built by `z4ge_add_multi_isa_executable` (see
+///             CMake/Z4GEArchitecture.cmake). Such an executable is compiled once per instruction set level into variants
+///             named `<Program>.<Variant>` (eg. `Server.x86-64-v3`), which are installed next to a launcher named
+///             `<Program>`. The launcher is compiled for the baseline of the target processor; it identifies the executing
+///             processor and replaces itself with the most demanding variant that the processor supports, eg.
+///             @code
+///                 int main (int ArgumentCount, char** Arguments) {
+///                     static const Z4GE::Configuration::LaunchVariant Variants[] = {
+///                         { Z4GE_ARCHITECTURE_X86_64_V3, "x86-64-v3" },
+///                         { Z4GE_ARCHITECTURE_X86_64_V2, "x86-64-v2" },
+///                         { Z4GE_ARCHITECTURE_X86_64_V1, "x86-64-v1" },
+///                     };
+///                     return Z4GE::Configuration::Launch (ArgumentCount, Arguments, "Server", Variants);
+///                 }
+///             @endcode
+///
+///             The variant can be forced by naming it in the `Z4GE_LAUNCH_VARIANT` environment variable, which is useful to
+///             compare the variants on the same host. A forced variant that the processor does not support is refused.
+/// @note       Unlike the other Z4GE.Configuration headers, this header is not included by @ref Z4GE/Configuration.hh since
+///             it depends on system headers.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Dispatch.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+#include <Z4GE/Configuration/RuntimeArchitecture.hh>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if Z4GE_PLATFORM & Z4GE_PLATFORM_WINDOWS
+#    include <process.h>
+#    define Z4GE_LAUNCHER_EXECUTABLE_SUFFIX ".exe"
+#else
+#    include <unistd.h>
+#    define Z4GE_LAUNCHER_EXECUTABLE_SUFFIX ""
+#endif
+
+#if Z4GE_PLATFORM & Z4GE_PLATFORM_MACOS
+#    include <mach-o/dyld.h>
+#endif
+
+namespace Z4GE { namespace Configuration {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      A variant of a multi instruction set executable
+    /// @details    The `Implementation` is the name of the variant, ie. the suffix of its file name
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    typedef DispatchCandidate<const char*> LaunchVariant;
+
+    namespace Detail {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Returns the path of the executing program, or @p Argument (ie. `argv[0]`) if it is not available
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline std::string GetExecutablePath (const char* Argument) {
+#if Z4GE_PLATFORM & (Z4GE_PLATFORM_LINUX | Z4GE_PLATFORM_ANDROID)
+            char          Buffer[4096];
+            const ssize_t Length = readlink ("/proc/self/exe", Buffer, sizeof (Buffer));
+            if (Length > 0 && static_cast<std::size_t> (Length) < sizeof (Buffer)) {
+                return std::string (Buffer, static_cast<std::size_t> (Length));
+            }
+#elif Z4GE_PLATFORM & Z4GE_PLATFORM_MACOS
+            char     Buffer[4096];
+            uint32_t Length = sizeof (Buffer);
+            if (_NSGetExecutablePath (Buffer, &Length) == 0) {
+                return std::string (Buffer);
+            }
+#endif
+            return Argument != nullptr ? std::string (Argument) : std::string ();
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Returns the path of @p Variant of @p Program, located in the directory of @p ExecutablePath
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline std::string GetVariantPath (const std::string& ExecutablePath, const char* Program, const char* Variant) {
+#if Z4GE_PLATFORM & Z4GE_PLATFORM_WINDOWS
+            const std::string::size_type Separator = ExecutablePath.find_last_of ("/\\");
+#else
+            const std::string::size_type Separator = ExecutablePath.find_last_of ('/');
+#endif
+            const std::string Directory =
+                Separator == std::string::npos ? std::string () : ExecutablePath.substr (0, Separator + 1);
+            return Directory + Program + "." + Variant + Z4GE_LAUNCHER_EXECUTABLE_SUFFIX;
+        }
+
+    } // namespace Detail
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Select the variant to be launched
+    /// @details    The variant named by the `Z4GE_LAUNCH_VARIANT` environment variable is selected if it is set, otherwise
+    ///             the variants are selected like @ref SelectImplementation, ie. they are expected to be ordered from the most
+    ///             to the least demanding one.
+    /// @param[in]  Variants    The variants, ordered by preference
+    /// @returns    The selected variant, or `nullptr` if the forced variant is unknown or not supported by the processor
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<std::size_t Count>
+    inline const LaunchVariant* SelectLaunchVariant (const LaunchVariant (&Variants)[Count]) {
+        const char* Forced = std::getenv ("Z4GE_LAUNCH_VARIANT");
+        if (Forced != nullptr && *Forced != '\0') {
+            for (std::size_t Index = 0; Index < Count; ++Index) {
+                if (std::strcmp (Forced, Variants[Index].Implementation) == 0) {
+                    return HasRuntimeArchitecture (Variants[Index].Architecture) ? &Variants[Index] : nullptr;
+                }
+            }
+            return nullptr;
+        }
+
+        const ArchitectureMask Architecture = GetRuntimeArchitecture ();
+        for (std::size_t Index = 0; Index < Count; ++Index) {
+            if ((Architecture & Variants[Index].Architecture) == Variants[Index].Architecture) {
+                return &Variants[Index];
+            }
+        }
+        return &Variants[Count - 1];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Replace the executing process with the selected variant of @p Program
+    /// @details    The variant receives the arguments and environment of the launcher. On Microsoft Windows, which cannot
+    ///             replace a process, the variant is spawned and its exit code is returned instead.
+    /// @param[in]  ArgumentCount   The argument count of `main`
+    /// @param[in]  Arguments       The arguments of `main`
+    /// @param[in]  Program         The name of the program, without the variant suffix
+    /// @param[in]  Variants        The variants, ordered by preference (see @ref SelectLaunchVariant)
+    /// @returns    Only on failure, with exit code 127
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<std::size_t Count>
+    inline int Launch (int ArgumentCount, char** Arguments, const char* Program, const LaunchVariant (&Variants)[Count]) {
+        const LaunchVariant* Variant = SelectLaunchVariant (Variants);
+        if (Variant == nullptr) {
+            std::fprintf (stderr, "%s: Z4GE_LAUNCH_VARIANT=%s is not a variant supported by this processor\n", Program,
+                          std::getenv ("Z4GE_LAUNCH_VARIANT"));
+            return 127;
+        }
+
+        const std::string Path = Detail::GetVariantPath (Detail::GetExecutablePath (ArgumentCount > 0 ? Arguments[0] : nullptr),
+                                                         Program, Variant->Implementation);
+#if Z4GE_PLATFORM & Z4GE_PLATFORM_WINDOWS
+        const std::intptr_t Status = _spawnv (_P_WAIT, Path.c_str (), Arguments);
+        if (Status != -1) {
+            return static_cast<int> (Status);
+        }
+#else
+        execv (Path.c_str (), Arguments);
+#endif
+        std::fprintf (stderr, "%s: cannot execute %s: %s\n", Program, Path.c_str (), std::strerror (errno));
+        return 127;
+    }
+
+}} // namespace Z4GE::Configuration
+
+/// @}
+
+#endif
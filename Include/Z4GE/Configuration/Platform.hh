@@ -72,7 +72,10 @@
 ///                 6.  SSE 4.2
 ///                 7.  AVX
 ///                 8.  AVX2
-///                 9.  NEON
+///                 9.  POPCNT, LZCNT, BMI 1, BMI 2, F16C and FMA
+///                 10. AVX-512 F, CD, BW, DQ, VL and VNNI
+///                 11. x86-64-v2, x86-64-v3 and x86-64-v4 psABI microarchitecture levels
+///                 12. NEON
 /// @note       This header file should not be directly included. If you wish to include this file, include
 ///             @ref Z4GE/Configuration.hh
 /// @addtogroup z4ge_configuration
@@ -299,33 +302,190 @@
 #define Z4GE_ARCHITECTURE_BIT_NEON 0x0800
 /// @brief      ARM V8 Architecture
 #define Z4GE_ARCHITECTURE_BIT_ARMV8 0x1000
+/// @brief      x86 - POPCNT Instruction
+#define Z4GE_ARCHITECTURE_BIT_POPCNT 0x2000
+/// @brief      x86 - LZCNT Instruction
+#define Z4GE_ARCHITECTURE_BIT_LZCNT 0x4000
+/// @brief      x86 - Bit Manipulation Instruction Set 1
+#define Z4GE_ARCHITECTURE_BIT_BMI1 0x8000
+/// @brief      x86 - Bit Manipulation Instruction Set 2
+#define Z4GE_ARCHITECTURE_BIT_BMI2 0x10000
+/// @brief      x86 - Half Precision Floating Point Conversion
+#define Z4GE_ARCHITECTURE_BIT_F16C 0x20000
+/// @brief      x86 - Fused Multiply Add (FMA3)
+#define Z4GE_ARCHITECTURE_BIT_FMA 0x40000
+/// @brief      x86 - AVX-512 Foundation
+#define Z4GE_ARCHITECTURE_BIT_AVX512F 0x80000
+/// @brief      x86 - AVX-512 Conflict Detection
+#define Z4GE_ARCHITECTURE_BIT_AVX512CD 0x100000
+/// @brief      x86 - AVX-512 Byte and Word
+#define Z4GE_ARCHITECTURE_BIT_AVX512BW 0x200000
+/// @brief      x86 - AVX-512 Doubleword and Quadword
+#define Z4GE_ARCHITECTURE_BIT_AVX512DQ 0x400000
+/// @brief      x86 - AVX-512 Vector Length Extensions
+#define Z4GE_ARCHITECTURE_BIT_AVX512VL 0x800000
+/// @brief      x86 - AVX-512 Vector Neural Network Instructions
+#define Z4GE_ARCHITECTURE_BIT_AVX512VNNI 0x1000000
 
 ///@brief       Unknown Architecture
 #define Z4GE_ARCHITECTURE_UNKNOWN 0x0000
 ///@brief       x86 Architecture
 #define Z4GE_ARCHITECTURE_X86 Z4GE_ARCHITECTURE_BIT_X86
 ///@brief       x86 + SSE
-#define Z4GE_ARCHITECTURE_SSE Z4GE_ARCHITECTURE_X86 | Z4GE_ARCHITECTURE_BIT_SSE
+#define Z4GE_ARCHITECTURE_SSE (Z4GE_ARCHITECTURE_X86 | Z4GE_ARCHITECTURE_BIT_SSE)
 ///@brief       SSE + SSE2
-#define Z4GE_ARCHITECTURE_SSE2 Z4GE_ARCHITECTURE_SSE | Z4GE_ARCHITECTURE_BIT_SSE2
+#define Z4GE_ARCHITECTURE_SSE2 (Z4GE_ARCHITECTURE_SSE | Z4GE_ARCHITECTURE_BIT_SSE2)
 ///@brief       SSE2 + SSE3
-#define Z4GE_ARCHITECTURE_SSE3 Z4GE_ARCHITECTURE_SSE2 | Z4GE_ARCHITECTURE_BIT_SSE3
+#define Z4GE_ARCHITECTURE_SSE3 (Z4GE_ARCHITECTURE_SSE2 | Z4GE_ARCHITECTURE_BIT_SSE3)
 ///@brief       SSE3 + SSSE3
-#define Z4GE_ARCHITECTURE_SSSE3 Z4GE_ARCHITECTURE_SSE3 | Z4GE_ARCHITECTURE_BIT_SSSE3
+#define Z4GE_ARCHITECTURE_SSSE3 (Z4GE_ARCHITECTURE_SSE3 | Z4GE_ARCHITECTURE_BIT_SSSE3)
 ///@brief       SSSE3 + SSE41
-#define Z4GE_ARCHITECTURE_SSE41 Z4GE_ARCHITECTURE_SSSE3 | Z4GE_ARCHITECTURE_BIT_SSE41
+#define Z4GE_ARCHITECTURE_SSE41 (Z4GE_ARCHITECTURE_SSSE3 | Z4GE_ARCHITECTURE_BIT_SSE41)
 ///@brief       SSE41 + SSE42
-#define Z4GE_ARCHITECTURE_SSE42 Z4GE_ARCHITECTURE_SSE41 | Z4GE_ARCHITECTURE_BIT_SSE42
+#define Z4GE_ARCHITECTURE_SSE42 (Z4GE_ARCHITECTURE_SSE41 | Z4GE_ARCHITECTURE_BIT_SSE42)
 ///@brief       SSE42 + AVX
-#define Z4GE_ARCHITECTURE_AVX Z4GE_ARCHITECTURE_SSE42 | Z4GE_ARCHITECTURE_BIT_AVX
+#define Z4GE_ARCHITECTURE_AVX (Z4GE_ARCHITECTURE_SSE42 | Z4GE_ARCHITECTURE_BIT_AVX)
 ///@brief       AVX + AVX2
-#define Z4GE_ARCHITECTURE_AVX2 Z4GE_ARCHITECTURE_AVX | Z4GE_ARCHITECTURE_BIT_AVX2
+#define Z4GE_ARCHITECTURE_AVX2 (Z4GE_ARCHITECTURE_AVX | Z4GE_ARCHITECTURE_BIT_AVX2)
+///@brief       x86-64 psABI baseline microarchitecture level (x86-64-v1): SSE2
+#define Z4GE_ARCHITECTURE_X86_64_V1 Z4GE_ARCHITECTURE_SSE2
+///@brief       x86-64 psABI microarchitecture level x86-64-v2: SSE42 + POPCNT
+#define Z4GE_ARCHITECTURE_X86_64_V2 (Z4GE_ARCHITECTURE_SSE42 | Z4GE_ARCHITECTURE_BIT_POPCNT)
+///@brief       x86-64 psABI microarchitecture level x86-64-v3: x86-64-v2 + AVX2 + BMI1 + BMI2 + F16C + FMA + LZCNT
+#define Z4GE_ARCHITECTURE_X86_64_V3                                                                                            \
+    (Z4GE_ARCHITECTURE_X86_64_V2 | Z4GE_ARCHITECTURE_AVX2 | Z4GE_ARCHITECTURE_BIT_BMI1 | Z4GE_ARCHITECTURE_BIT_BMI2 |         \
+     Z4GE_ARCHITECTURE_BIT_F16C | Z4GE_ARCHITECTURE_BIT_FMA | Z4GE_ARCHITECTURE_BIT_LZCNT)
+///@brief       x86-64 psABI microarchitecture level x86-64-v4: x86-64-v3 + AVX-512 F, CD, BW, DQ and VL
+#define Z4GE_ARCHITECTURE_X86_64_V4                                                                                            \
+    (Z4GE_ARCHITECTURE_X86_64_V3 | Z4GE_ARCHITECTURE_BIT_AVX512F | Z4GE_ARCHITECTURE_BIT_AVX512CD |                           \
+     Z4GE_ARCHITECTURE_BIT_AVX512BW | Z4GE_ARCHITECTURE_BIT_AVX512DQ | Z4GE_ARCHITECTURE_BIT_AVX512VL)
+///@brief       x86-64-v4 + AVX-512 VNNI
+#define Z4GE_ARCHITECTURE_AVX512VNNI (Z4GE_ARCHITECTURE_X86_64_V4 | Z4GE_ARCHITECTURE_BIT_AVX512VNNI)
 ///@brief       ARM Architecture
 #define Z4GE_ARCHITECTURE_ARM Z4GE_ARCHITECTURE_BIT_ARM
 ///@brief       ARM + ARM Neon
-#define Z4GE_ARCHITECTURE_NEON Z4GE_ARCHITECTURE_ARM | Z4GE_ARCHITECTURE_BIT_NEON
+#define Z4GE_ARCHITECTURE_NEON (Z4GE_ARCHITECTURE_ARM | Z4GE_ARCHITECTURE_BIT_NEON)
 ///@brief       ARM Neon + ARMV8 Intrinsics
-#define Z4GE_ARCHITECTURE_ARMV8 Z4GE_ARCHITECTURE_NEON | Z4GE_ARCHITECTURE_BIT_ARMV8
+#define Z4GE_ARCHITECTURE_ARMV8 (Z4GE_ARCHITECTURE_NEON | Z4GE_ARCHITECTURE_BIT_ARMV8)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Instruction sets enabled by the compiler flags
+/// @details    Each `Z4GE_ARCHITECTURE_PREDEFINED_*` macro expands to the architecture bits of one instruction set if the
+///             compiler predefines its macro (`__AVX2__`, `__FMA__`, `__BMI2__`, ...), and to `0` otherwise. They are
+///             combined independently when `Z4GE_FORCE_INTRINSICS` is defined, so that `-mavx2` keeps AVX2 without the remaining
+///             x86-64-v3 instruction sets. The SSE / AVX ladder macros carry the instruction sets they imply, as MSVC only
+///             predefines the highest `/arch` level.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSE Z4GE_ARCHITECTURE_SSE
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSE 0
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSE2 Z4GE_ARCHITECTURE_SSE2
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSE2 0
+#endif
+#if defined(__SSE3__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSE3 Z4GE_ARCHITECTURE_SSE3
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSE3 0
+#endif
+#if defined(__SSSE3__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSSE3 Z4GE_ARCHITECTURE_SSSE3
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSSE3 0
+#endif
+#if defined(__SSE4_1__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSE41 Z4GE_ARCHITECTURE_SSE41
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSE41 0
+#endif
+#if defined(__SSE4_2__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSE42 Z4GE_ARCHITECTURE_SSE42
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_SSE42 0
+#endif
+#if defined(__AVX__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX Z4GE_ARCHITECTURE_AVX
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX 0
+#endif
+#if defined(__AVX2__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX2 Z4GE_ARCHITECTURE_AVX2
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX2 0
+#endif
+#if defined(__POPCNT__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_POPCNT Z4GE_ARCHITECTURE_BIT_POPCNT
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_POPCNT 0
+#endif
+#if defined(__LZCNT__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_LZCNT Z4GE_ARCHITECTURE_BIT_LZCNT
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_LZCNT 0
+#endif
+#if defined(__BMI__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_BMI1 Z4GE_ARCHITECTURE_BIT_BMI1
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_BMI1 0
+#endif
+#if defined(__BMI2__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_BMI2 Z4GE_ARCHITECTURE_BIT_BMI2
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_BMI2 0
+#endif
+#if defined(__F16C__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_F16C Z4GE_ARCHITECTURE_BIT_F16C
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_F16C 0
+#endif
+#if defined(__FMA__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_FMA Z4GE_ARCHITECTURE_BIT_FMA
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_FMA 0
+#endif
+#if defined(__AVX512F__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512F Z4GE_ARCHITECTURE_BIT_AVX512F
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512F 0
+#endif
+#if defined(__AVX512CD__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512CD Z4GE_ARCHITECTURE_BIT_AVX512CD
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512CD 0
+#endif
+#if defined(__AVX512BW__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512BW Z4GE_ARCHITECTURE_BIT_AVX512BW
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512BW 0
+#endif
+#if defined(__AVX512DQ__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512DQ Z4GE_ARCHITECTURE_BIT_AVX512DQ
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512DQ 0
+#endif
+#if defined(__AVX512VL__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512VL Z4GE_ARCHITECTURE_BIT_AVX512VL
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512VL 0
+#endif
+#if defined(__AVX512VNNI__)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512VNNI Z4GE_ARCHITECTURE_BIT_AVX512VNNI
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_AVX512VNNI 0
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_NEON Z4GE_ARCHITECTURE_NEON
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_NEON 0
+#endif
+#if defined(__ARM_ARCH) && (__ARM_ARCH >= 8)
+#    define Z4GE_ARCHITECTURE_PREDEFINED_ARMV8 Z4GE_ARCHITECTURE_ARMV8
+#else
+#    define Z4GE_ARCHITECTURE_PREDEFINED_ARMV8 0
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief      Z4GE.Configuration Architecture
@@ -341,6 +501,10 @@
 ///             -#  x86 Architecture + SSE + SSE 2 + SSE 3 + SSSE 3 + SSE 4.1 + SSE 4.2
 ///             -#  x86 Architecture + SSE + SSE 2 + SSE 3 + SSSE 3 + SSE 4.1 + SSE 4.2 + AVX
 ///             -#  x86 Architecture + SSE + SSE 2 + SSE 3 + SSSE 3 + SSE 4.1 + SSE 4.2 + AVX + AVX 2
+///             -#  x86-64-v2 (SSE 4.2 + POPCNT)
+///             -#  x86-64-v3 (x86-64-v2 + AVX 2 + BMI 1 + BMI 2 + F16C + FMA + LZCNT)
+///             -#  x86-64-v4 (x86-64-v3 + AVX-512 F + AVX-512 CD + AVX-512 BW + AVX-512 DQ + AVX-512 VL)
+///             -#  x86-64-v4 + AVX-512 VNNI
 ///             -#  ARM Architecture
 ///             -#  ARM Architecture + ARM Neon
 ///             -#  ARM Architecture + ARM Neon + ARM V8 Intrinsics
@@ -348,10 +512,18 @@
 #ifndef Z4GE_ARCHITECTURE
 #    if defined(Z4GE_FORCE_UNKNOWN_ARCHITECTURE) || defined(Z4GE_NO_SIMD_INTRINSICS)
 #        define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_UNKNOWN
+#    elif defined(Z4GE_FORCE_AVX512VNNI_INTRINSICS)
+#        define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_AVX512VNNI
+#    elif defined(Z4GE_FORCE_X86_64_V4_INTRINSICS)
+#        define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_X86_64_V4
+#    elif defined(Z4GE_FORCE_X86_64_V3_INTRINSICS)
+#        define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_X86_64_V3
 #    elif defined(Z4GE_FORCE_AVX2_INTRINSICS)
 #        define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_AVX2
 #    elif defined(Z4GE_FORCE_AVX_INTRINSICS)
 #        define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_AVX
+#    elif defined(Z4GE_FORCE_X86_64_V2_INTRINSICS)
+#        define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_X86_64_V2
 #    elif defined(Z4GE_FORCE_SSE42_INTRINSICS)
 #        define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_SSE42
 #    elif defined(Z4GE_FORCE_SSE41_INTRINSICS)
@@ -373,28 +545,20 @@
 #    elif defined(Z4GE_FORCE_ARM_INTRINSICS)
 #        define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_ARM
 #    elif defined(Z4GE_FORCE_INTRINSICS)
-#        if defined(__AVX2__)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_AVX2
-#        elif defined(__AVX__)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_AVX
-#        elif defined(__SSE4_2__)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_SSE42
-#        elif defined(__SSE4_1__)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_SSE41
-#        elif defined(__SSSE3__)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_SSSE3
-#        elif defined(__SSE3__)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_SSE3
-#        elif defined(__SSE2__) || defined(__x86_64__) || defined(_M_X64) || defined(_M_IX86_FP)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_SSE2
-#        elif defined(__i386__)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_X86
-#        elif defined(__ARM_ARCH) && (__ARM_ARCH >= 8)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_ARMV8
-#        elif defined(__ARM_NEON)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_NEON
-#        elif defined(__arm__) || defined(_M_ARM)
-#            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_ARM
+#        if defined(__x86_64__) || defined(_M_X64) || defined(_M_IX86) || defined(__i386__)
+#            define Z4GE_ARCHITECTURE                                                                                          \
+                (Z4GE_ARCHITECTURE_X86 | Z4GE_ARCHITECTURE_PREDEFINED_SSE | Z4GE_ARCHITECTURE_PREDEFINED_SSE2 |                \
+                 Z4GE_ARCHITECTURE_PREDEFINED_SSE3 | Z4GE_ARCHITECTURE_PREDEFINED_SSSE3 | Z4GE_ARCHITECTURE_PREDEFINED_SSE41 | \
+                 Z4GE_ARCHITECTURE_PREDEFINED_SSE42 | Z4GE_ARCHITECTURE_PREDEFINED_AVX | Z4GE_ARCHITECTURE_PREDEFINED_AVX2 |   \
+                 Z4GE_ARCHITECTURE_PREDEFINED_POPCNT | Z4GE_ARCHITECTURE_PREDEFINED_LZCNT |                                    \
+                 Z4GE_ARCHITECTURE_PREDEFINED_BMI1 | Z4GE_ARCHITECTURE_PREDEFINED_BMI2 | Z4GE_ARCHITECTURE_PREDEFINED_F16C |   \
+                 Z4GE_ARCHITECTURE_PREDEFINED_FMA | Z4GE_ARCHITECTURE_PREDEFINED_AVX512F |                                     \
+                 Z4GE_ARCHITECTURE_PREDEFINED_AVX512CD | Z4GE_ARCHITECTURE_PREDEFINED_AVX512BW |                               \
+                 Z4GE_ARCHITECTURE_PREDEFINED_AVX512DQ | Z4GE_ARCHITECTURE_PREDEFINED_AVX512VL |                               \
+                 Z4GE_ARCHITECTURE_PREDEFINED_AVX512VNNI)
+#        elif defined(__arm__) || defined(_M_ARM) || defined(__aarch64__) || defined(_M_ARM64)
+#            define Z4GE_ARCHITECTURE                                                                                          \
+                (Z4GE_ARCHITECTURE_ARM | Z4GE_ARCHITECTURE_PREDEFINED_NEON | Z4GE_ARCHITECTURE_PREDEFINED_ARMV8)
 #        else
 #            define Z4GE_ARCHITECTURE Z4GE_ARCHITECTURE_UNKNOWN
 #        endif
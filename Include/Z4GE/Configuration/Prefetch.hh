@@ -0,0 +1,165 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__PREFETCH_HH_
+#define Z4GE_CONFIGURATION__PREFETCH_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/Prefetch.hh
+/// @brief      Software prefetch of memory ranges
+/// @details    This header provides the @ref Z4GE_PREFETCH_READ / @ref Z4GE_PREFETCH_WRITE hints, and
+///             @ref Z4GE::PrefetchRange and @ref Z4GE::PrefetchRangeForWrite, which issue one hint per cache line of a span
+///             of objects. They are meant for warming a buffer whose access pattern the hardware prefetchers cannot follow
+///             (eg. a gather through an index list, a freshly allocated arena block) a few iterations before it is used.
+///             The intrinsics headers that Microsoft Visual C++ needs for the hints are only included by this header.
+/// @note       Prefetching a range larger than the L1 data cache evicts the lines prefetched first; prefetch in chunks
+///             close to the consumer instead.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CacheLine.hh>
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <cstddef>
+#include <cstdint>
+
+#if Z4GE_COMPILER & Z4GE_COMPILER_MSVC && (defined(_M_IX86) || defined(_M_X64))
+#    include <xmmintrin.h>
+#elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC && (defined(_M_ARM) || defined(_M_ARM64))
+#    include <intrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent software prefetch of memory that is about to be read
+/// @details    This macro expands to a compiler independent hint that requests the cache line containing @p __POINTER__ to
+///             be brought into the cache ahead of its use, so that several cache misses (eg. hash table probes, graph
+///             nodes) can be in flight at once. It compiles to nothing where no prefetch instruction is available.
+///
+///             @p __LOCALITY__ is an integral constant in [0, 3], mirroring `__builtin_prefetch`
+///             |  Locality  |  Meaning                                    |  x86 hint       |
+///             | ---------- | ------------------------------------------- | --------------- |
+///             | 0          | No temporal locality, evict after use       | _MM_HINT_NTA    |
+///             | 1          | Low temporal locality                       | _MM_HINT_T2     |
+///             | 2          | Moderate temporal locality                  | _MM_HINT_T1     |
+///             | 3          | High temporal locality, keep in every level | _MM_HINT_T0     |
+/// @note       Prefetches never fault, thus @p __POINTER__ may point past the end of a buffer
+/// @see        Z4GE_PREFETCH_WRITE
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_PREFETCH_READ
+#    if Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC)
+#        define Z4GE_PREFETCH_READ(__POINTER__, __LOCALITY__) __builtin_prefetch ((__POINTER__), 0, (__LOCALITY__))
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_MSVC | Z4GE_COMPILER_INTEL) && (defined(_M_IX86) || defined(_M_X64))
+#        define Z4GE_PREFETCH_READ(__POINTER__, __LOCALITY__)                                                                \
+            _mm_prefetch (reinterpret_cast<const char*> (__POINTER__),                                                      \
+                          (__LOCALITY__) >= 3   ? _MM_HINT_T0                                                               \
+                          : (__LOCALITY__) == 2 ? _MM_HINT_T1                                                               \
+                          : (__LOCALITY__) == 1 ? _MM_HINT_T2                                                               \
+                                                : _MM_HINT_NTA)
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC && defined(_M_ARM64)
+//  PRFM PLD{L1, L2, L3}KEEP, or PLDL1STRM for non-temporal data
+#        define Z4GE_PREFETCH_READ(__POINTER__, __LOCALITY__)                                                                \
+            __prefetch2 ((__POINTER__), (__LOCALITY__) >= 3 ? 0 : (__LOCALITY__) == 2 ? 2 : (__LOCALITY__) == 1 ? 4 : 1)
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC && defined(_M_ARM)
+#        define Z4GE_PREFETCH_READ(__POINTER__, __LOCALITY__) __prefetch (__POINTER__)
+#    elif defined(__ARMCC_VERSION)
+#        define Z4GE_PREFETCH_READ(__POINTER__, __LOCALITY__) __pld (__POINTER__)
+#    else
+#        define Z4GE_PREFETCH_READ(__POINTER__, __LOCALITY__) ((void)0)
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Compiler independent software prefetch of memory that is about to be written
+/// @details    This macro is the equivalent of @ref Z4GE_PREFETCH_READ for memory that is about to be written, requesting the
+///             cache line in an exclusive state where the architecture supports it (eg. `PREFETCHW`, `PRFM PST*`). x86
+///             targets compiled with Microsoft Visual C++ use a read prefetch instead.
+/// @see        Z4GE_PREFETCH_READ
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_PREFETCH_WRITE
+#    if Z4GE_COMPILER & (Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_GCC)
+#        define Z4GE_PREFETCH_WRITE(__POINTER__, __LOCALITY__) __builtin_prefetch ((__POINTER__), 1, (__LOCALITY__))
+#    elif Z4GE_COMPILER & (Z4GE_COMPILER_MSVC | Z4GE_COMPILER_INTEL) && (defined(_M_IX86) || defined(_M_X64))
+#        define Z4GE_PREFETCH_WRITE(__POINTER__, __LOCALITY__) Z4GE_PREFETCH_READ (__POINTER__, __LOCALITY__)
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC && defined(_M_ARM64)
+#        define Z4GE_PREFETCH_WRITE(__POINTER__, __LOCALITY__)                                                               \
+            __prefetch2 ((__POINTER__), (__LOCALITY__) >= 3 ? 16 : (__LOCALITY__) == 2 ? 18 : (__LOCALITY__) == 1 ? 20 : 17)
+#    elif Z4GE_COMPILER & Z4GE_COMPILER_MSVC && defined(_M_ARM)
+#        define Z4GE_PREFETCH_WRITE(__POINTER__, __LOCALITY__) __prefetchw (__POINTER__)
+#    elif defined(__ARMCC_VERSION)
+#        define Z4GE_PREFETCH_WRITE(__POINTER__, __LOCALITY__) __pldw (__POINTER__)
+#    else
+#        define Z4GE_PREFETCH_WRITE(__POINTER__, __LOCALITY__) ((void)0)
+#    endif
+#endif
+
+namespace Z4GE {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Prefetches every cache line of [@p Begin, @p Begin + @p Count) for reading
+    /// @tparam     Locality    Temporal locality hint in [0, 3], see @ref Z4GE_PREFETCH_READ
+    /// @tparam     T           Element type of the range
+    /// @param      Begin       First element of the range, may be `nullptr` if @p Count is zero
+    /// @param      Count       Number of elements in the range
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<int Locality = 3, typename T>
+    inline void PrefetchRange (const T* Begin, std::size_t Count) Z4GE_NOEXCEPT {
+        Z4GE_STATIC_ASSERT (Locality >= 0 && Locality <= 3, "Prefetch locality must be in [0, 3]");
+
+        const char* const Bytes = reinterpret_cast<const char*> (Begin);
+        const std::size_t Size  = Count * sizeof (T);
+        if (Size == 0) { return; }
+
+        //  Start from the cache line containing the first byte so a range straddling a line boundary is fully covered
+        const std::size_t Offset = reinterpret_cast<std::uintptr_t> (Bytes) % Z4GE_CACHELINE_SIZE;
+        for (std::size_t Line = 0; Line < Offset + Size; Line += Z4GE_CACHELINE_SIZE) {
+            Z4GE_PREFETCH_READ (Bytes - Offset + Line, Locality);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Prefetches every cache line of [@p Begin, @p Begin + @p Count) for writing
+    /// @tparam     Locality    Temporal locality hint in [0, 3], see @ref Z4GE_PREFETCH_WRITE
+    /// @tparam     T           Element type of the range
+    /// @param      Begin       First element of the range, may be `nullptr` if @p Count is zero
+    /// @param      Count       Number of elements in the range
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<int Locality = 3, typename T>
+    inline void PrefetchRangeForWrite (T* Begin, std::size_t Count) Z4GE_NOEXCEPT {
+        Z4GE_STATIC_ASSERT (Locality >= 0 && Locality <= 3, "Prefetch locality must be in [0, 3]");
+
+        char* const       Bytes = reinterpret_cast<char*> (Begin);
+        const std::size_t Size  = Count * sizeof (T);
+        if (Size == 0) { return; }
+
+        const std::size_t Offset = reinterpret_cast<std::uintptr_t> (Bytes) % Z4GE_CACHELINE_SIZE;
+        for (std::size_t Line = 0; Line < Offset + Size; Line += Z4GE_CACHELINE_SIZE) {
+            Z4GE_PREFETCH_WRITE (Bytes - Offset + Line, Locality);
+        }
+    }
+
+} // namespace Z4GE
+
+/// @}
+
+#endif
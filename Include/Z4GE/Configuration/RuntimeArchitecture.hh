@@ -0,0 +1,271 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__RUNTIME_ARCHITECTURE_HH_
+#define Z4GE_CONFIGURATION__RUNTIME_ARCHITECTURE_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/RuntimeArchitecture.hh
+/// @brief      Runtime Architecture / SIMD Capability Identification
+/// @details    @ref Z4GE_ARCHITECTURE only describes the instruction sets that the compiler was allowed to emit. A binary that
+///             was built for a conservative baseline (eg. plain x86-64) never learns that the host it is running on supports
+///             a wider instruction set. This header queries the executing processor (CPUID / XGETBV on x86, `getauxval` on
+///             Linux / Android ARM) and reports the result as the same `Z4GE_ARCHITECTURE_BIT_*` bitmask that is used by
+///             @ref Z4GE_ARCHITECTURE, so that compile-time and runtime capabilities can be compared directly.
+///
+///             The processor is queried once; the result is cached in a constant-initialized global and every subsequent
+///             query is a single relaxed atomic load, which makes it suitable for use on hot paths.
+/// @note       Unlike the other Z4GE.Configuration headers, this header is not included by @ref Z4GE/Configuration.hh since
+///             it depends on system headers. Include it explicitly where runtime identification is required.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_IX86) || defined(__i386__)
+#    define Z4GE_RUNTIME_ARCHITECTURE_X86 Z4GE_ENABLE
+#    if Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#else
+#    define Z4GE_RUNTIME_ARCHITECTURE_X86 Z4GE_DISABLE
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__) || defined(_M_ARM)
+#    define Z4GE_RUNTIME_ARCHITECTURE_ARM Z4GE_ENABLE
+#    if Z4GE_PLATFORM & (Z4GE_PLATFORM_LINUX | Z4GE_PLATFORM_ANDROID)
+#        include <sys/auxv.h>
+#    endif
+#else
+#    define Z4GE_RUNTIME_ARCHITECTURE_ARM Z4GE_DISABLE
+#endif
+
+namespace Z4GE { namespace Configuration {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Architecture Bitmask
+    /// @details    A combination of `Z4GE_ARCHITECTURE_BIT_*` flags, as used by @ref Z4GE_ARCHITECTURE
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    typedef std::uint32_t ArchitectureMask;
+
+    namespace Detail {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Marker bit that distinguishes a resolved (possibly empty) architecture from the unresolved state
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Z4GE_CONSTEXPR_OR_CONST ArchitectureMask RuntimeArchitectureResolved = 0x80000000u;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Runtime Architecture Cache
+        /// @details    The cache is a static data member of a class template so that a single instance is shared between all
+        ///             the translation units without requiring CXX 17 `inline` variables. `std::atomic` has a `constexpr`
+        ///             constructor and therefore the cache is constant-initialized, i.e. no dynamic initialization guard.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename Tag = void>
+        struct RuntimeArchitectureCache {
+            static std::atomic<ArchitectureMask> Value;
+        };
+
+        template<typename Tag>
+        std::atomic<ArchitectureMask> RuntimeArchitectureCache<Tag>::Value (0u);
+
+#if Z4GE_RUNTIME_ARCHITECTURE_X86
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Executes the `cpuid` instruction for the given @p Leaf and @p SubLeaf
+        /// @param[in]  Leaf        The CPUID leaf (EAX)
+        /// @param[in]  SubLeaf     The CPUID sub-leaf (ECX)
+        /// @param[out] Registers   EAX, EBX, ECX and EDX, in that order. Zeroed if the leaf is not supported
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename Tag = void>
+        inline void QueryCpuid (std::uint32_t Leaf, std::uint32_t SubLeaf, std::uint32_t (&Registers)[4]) Z4GE_NOEXCEPT {
+#    if Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+            int Values[4] = { 0, 0, 0, 0 };
+            __cpuidex (Values, static_cast<int> (Leaf), static_cast<int> (SubLeaf));
+            for (int Index = 0; Index < 4; ++Index) {
+                Registers[Index] = static_cast<std::uint32_t> (Values[Index]);
+            }
+#    else
+            unsigned int Eax = 0, Ebx = 0, Ecx = 0, Edx = 0;
+            if (!__get_cpuid_count (Leaf, SubLeaf, &Eax, &Ebx, &Ecx, &Edx)) {
+                Eax = Ebx = Ecx = Edx = 0;
+            }
+            Registers[0] = Eax;
+            Registers[1] = Ebx;
+            Registers[2] = Ecx;
+            Registers[3] = Edx;
+#    endif
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Reads the lower 32 bits of the extended control register XCR0
+        /// @details    XCR0 reports which register states the operating system saves on context switches. AVX registers can
+        ///             only be used if the OS has enabled both the SSE (bit 1) and the AVX (bit 2) states.
+        /// @note       Must only be called when CPUID reports OSXSAVE
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename Tag = void>
+        inline std::uint32_t ReadXcr0 (void) Z4GE_NOEXCEPT {
+#    if Z4GE_COMPILER & Z4GE_COMPILER_MSVC
+            return static_cast<std::uint32_t> (_xgetbv (0));
+#    else
+            std::uint32_t Eax = 0, Edx = 0;
+            __asm__ __volatile__("xgetbv" : "=a"(Eax), "=d"(Edx) : "c"(0));
+            Z4GE_UNUSED (Edx);
+            return Eax;
+#    endif
+        }
+#endif
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Queries the executing processor for its architecture and SIMD capabilities
+        /// @details    This function performs the actual (uncached) detection. Prefer
+        ///             @ref Z4GE::Configuration::GetRuntimeArchitecture "GetRuntimeArchitecture", which caches the result.
+        /// @tparam     Tag     A type of internal linkage gives the detection (and @ref QueryCpuid / @ref ReadXcr0) internal
+        ///                     linkage, so that it is compiled with the options of the calling translation unit rather than
+        ///                     taken from another one by the linker (see @ref Z4GE/Configuration/ArchitectureGuard.hh)
+        /// @returns    A combination of `Z4GE_ARCHITECTURE_BIT_*` flags
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename Tag = void>
+        inline ArchitectureMask DetectRuntimeArchitecture (void) Z4GE_NOEXCEPT {
+            ArchitectureMask Architecture = Z4GE_ARCHITECTURE_UNKNOWN;
+
+#if Z4GE_RUNTIME_ARCHITECTURE_X86
+            std::uint32_t Registers[4];
+            Architecture |= Z4GE_ARCHITECTURE_BIT_X86;
+
+            QueryCpuid<Tag> (0, 0, Registers);
+            const std::uint32_t MaximumLeaf = Registers[0];
+            if (MaximumLeaf < 1) {
+                return Architecture;
+            }
+
+            QueryCpuid<Tag> (1, 0, Registers);
+            const std::uint32_t Leaf1Ecx = Registers[2];
+            const std::uint32_t Leaf1Edx = Registers[3];
+            if (Leaf1Edx & (1u << 25)) Architecture |= Z4GE_ARCHITECTURE_BIT_SSE;
+            if (Leaf1Edx & (1u << 26)) Architecture |= Z4GE_ARCHITECTURE_BIT_SSE2;
+            if (Leaf1Ecx & (1u << 0)) Architecture |= Z4GE_ARCHITECTURE_BIT_SSE3;
+            if (Leaf1Ecx & (1u << 9)) Architecture |= Z4GE_ARCHITECTURE_BIT_SSSE3;
+            if (Leaf1Ecx & (1u << 19)) Architecture |= Z4GE_ARCHITECTURE_BIT_SSE41;
+            if (Leaf1Ecx & (1u << 20)) Architecture |= Z4GE_ARCHITECTURE_BIT_SSE42;
+            if (Leaf1Ecx & (1u << 23)) Architecture |= Z4GE_ARCHITECTURE_BIT_POPCNT;
+
+            //  The VEX / EVEX encoded register states have to be enabled by the OS (OSXSAVE + XCR0) before use. AVX requires
+            //  the SSE and AVX states (XCR0[2:1]), AVX-512 additionally requires the opmask and ZMM states (XCR0[7:5])
+            const std::uint32_t Xcr0          = (Leaf1Ecx & (1u << 27)) ? ReadXcr0<Tag> () : 0u;
+            const bool          OsSavesAvx    = (Xcr0 & 0x06u) == 0x06u;
+            const bool          OsSavesAvx512 = (Xcr0 & 0xE6u) == 0xE6u;
+            if (OsSavesAvx) {
+                if (Leaf1Ecx & (1u << 28)) Architecture |= Z4GE_ARCHITECTURE_BIT_AVX;
+                if (Leaf1Ecx & (1u << 12)) Architecture |= Z4GE_ARCHITECTURE_BIT_FMA;
+                if (Leaf1Ecx & (1u << 29)) Architecture |= Z4GE_ARCHITECTURE_BIT_F16C;
+            }
+
+            if (MaximumLeaf >= 7) {
+                QueryCpuid<Tag> (7, 0, Registers);
+                const std::uint32_t Leaf7Ebx = Registers[1];
+                const std::uint32_t Leaf7Ecx = Registers[2];
+                if (Leaf7Ebx & (1u << 3)) Architecture |= Z4GE_ARCHITECTURE_BIT_BMI1;
+                if (Leaf7Ebx & (1u << 8)) Architecture |= Z4GE_ARCHITECTURE_BIT_BMI2;
+                if (OsSavesAvx && (Leaf7Ebx & (1u << 5))) Architecture |= Z4GE_ARCHITECTURE_BIT_AVX2;
+                if (OsSavesAvx512) {
+                    if (Leaf7Ebx & (1u << 16)) Architecture |= Z4GE_ARCHITECTURE_BIT_AVX512F;
+                    if (Leaf7Ebx & (1u << 17)) Architecture |= Z4GE_ARCHITECTURE_BIT_AVX512DQ;
+                    if (Leaf7Ebx & (1u << 28)) Architecture |= Z4GE_ARCHITECTURE_BIT_AVX512CD;
+                    if (Leaf7Ebx & (1u << 30)) Architecture |= Z4GE_ARCHITECTURE_BIT_AVX512BW;
+                    if (Leaf7Ebx & (1u << 31)) Architecture |= Z4GE_ARCHITECTURE_BIT_AVX512VL;
+                    if (Leaf7Ecx & (1u << 11)) Architecture |= Z4GE_ARCHITECTURE_BIT_AVX512VNNI;
+                }
+            }
+
+            QueryCpuid<Tag> (0x80000000u, 0, Registers);
+            if (Registers[0] >= 0x80000001u) {
+                QueryCpuid<Tag> (0x80000001u, 0, Registers);
+                if (Registers[2] & (1u << 5)) Architecture |= Z4GE_ARCHITECTURE_BIT_LZCNT;
+            }
+#elif Z4GE_RUNTIME_ARCHITECTURE_ARM
+            Architecture |= Z4GE_ARCHITECTURE_BIT_ARM;
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            Architecture |= Z4GE_ARCHITECTURE_BIT_ARMV8;
+#        if Z4GE_PLATFORM & (Z4GE_PLATFORM_LINUX | Z4GE_PLATFORM_ANDROID)
+            //  HWCAP_ASIMD
+            if (getauxval (AT_HWCAP) & (1ul << 1)) Architecture |= Z4GE_ARCHITECTURE_BIT_NEON;
+#        else
+            //  Advanced SIMD is mandatory on AArch64 for every other supported platform
+            Architecture |= Z4GE_ARCHITECTURE_BIT_NEON;
+#        endif
+#    else
+#        if Z4GE_PLATFORM & (Z4GE_PLATFORM_LINUX | Z4GE_PLATFORM_ANDROID)
+            //  HWCAP_NEON
+            if (getauxval (AT_HWCAP) & (1ul << 12)) Architecture |= Z4GE_ARCHITECTURE_BIT_NEON;
+#        elif defined(__ARM_NEON)
+            Architecture |= Z4GE_ARCHITECTURE_BIT_NEON;
+#        endif
+#        if defined(__ARM_ARCH) && (__ARM_ARCH >= 8)
+            Architecture |= Z4GE_ARCHITECTURE_BIT_ARMV8;
+#        endif
+#    endif
+#endif
+
+            return Architecture;
+        }
+
+    } // namespace Detail
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Get the architecture and SIMD capabilities of the executing processor
+    /// @details    This function returns the `Z4GE_ARCHITECTURE_BIT_*` flags supported by the processor that is executing the
+    ///             program, as opposed to @ref Z4GE_ARCHITECTURE, which represents the capabilities assumed at compile time.
+    ///             The processor is queried on the first call and the result is cached; concurrent first calls are benign,
+    ///             since every thread computes the same value.
+    /// @returns    A combination of `Z4GE_ARCHITECTURE_BIT_*` flags
+    /// @see        Z4GE_ARCHITECTURE
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline ArchitectureMask GetRuntimeArchitecture (void) Z4GE_NOEXCEPT {
+        ArchitectureMask Architecture = Detail::RuntimeArchitectureCache<>::Value.load (std::memory_order_relaxed);
+        if (Z4GE_UNAUDITED_UNLIKELY (!(Architecture & Detail::RuntimeArchitectureResolved))) {
+            Architecture = Detail::DetectRuntimeArchitecture () | Detail::RuntimeArchitectureResolved;
+            Detail::RuntimeArchitectureCache<>::Value.store (Architecture, std::memory_order_relaxed);
+        }
+        return Architecture & ~Detail::RuntimeArchitectureResolved;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Checks whether the executing processor supports all of the given architecture flags
+    /// @param[in]  Architecture    A combination of `Z4GE_ARCHITECTURE_BIT_*` flags or a `Z4GE_ARCHITECTURE_*` level
+    /// @returns    `true` if every flag in @p Architecture is supported by the executing processor
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool HasRuntimeArchitecture (ArchitectureMask Architecture) Z4GE_NOEXCEPT {
+        return (GetRuntimeArchitecture () & Architecture) == Architecture;
+    }
+
+}} // namespace Z4GE::Configuration
+
+/// @}
+
+#endif
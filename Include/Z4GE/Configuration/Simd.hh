@@ -0,0 +1,1802 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__SIMD_HH_
+#define Z4GE_CONFIGURATION__SIMD_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/Simd.hh
+/// @brief      Portable fixed-width SIMD vector types
+/// @details    This header provides fixed-width vector types that are mapped onto the SIMD intrinsics selected by
+///             @ref Z4GE_ARCHITECTURE, so that Z4GE packages do not have to spell out the same
+///             `#if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_*` blocks for every kernel.
+///
+///             The following vector types are provided, along with their mask types (`Vector::MaskType`)
+///
+///             |  Type      |  Lanes  |  Native implementation                          |
+///             | ---------- | ------- | ----------------------------------------------- |
+///             | Float32x4  | 4       | SSE2, NEON                                      |
+///             | Float32x8  | 8       | AVX2                                            |
+///             | Float32x16 | 16      | AVX-512 F                                       |
+///             | Int32x4    | 4       | SSE2, NEON                                      |
+///             | Int32x8    | 8       | AVX2                                            |
+///             | Int32x16   | 16      | AVX-512 F                                       |
+///             | Int8x16    | 16      | SSE2, NEON                                      |
+///             | Int8x32    | 32      | AVX2                                            |
+///             | Int8x64    | 64      | AVX-512 BW                                      |
+///
+///             A type whose native implementation is not enabled by @ref Z4GE_ARCHITECTURE (including every type when it
+///             is @ref Z4GE_ARCHITECTURE_UNKNOWN) falls back to a portable scalar implementation with the same interface,
+///             thus code written against these types compiles everywhere and is vectorized wherever possible.
+///
+///             Every vector type provides
+///                 -#  `Load`, `LoadAligned`, `Store` and `StoreAligned`
+///                 -#  `+`, `-`, `*` (not for 8-bit lanes) and `/` (floating point lanes only)
+///                 -#  `==`, `!=`, `<`, `<=`, `>` and `>=`, that produce a mask
+///                 -#  `Min`, `Max` and `Select` (blend of two vectors based on a mask)
+///                 -#  `Shuffle<I0, I1, I2, I3>` (32-bit lanes only), applied to each group of 4 consecutive lanes
+///                 -#  `ReduceAdd`, `ReduceMin` and `ReduceMax` horizontal reductions. The sum of 8-bit lanes is widened to
+///                     `std::int32_t`
+///             Every mask type provides `&`, `|`, `^`, `~`, `Any`, `All`, `None` and `ToBits`.
+/// @note       Unlike the other Z4GE.Configuration headers, this header is not included by @ref Z4GE/Configuration.hh since
+///             it depends on the intrinsics headers. The intrinsics selected by @ref Z4GE_ARCHITECTURE must be enabled for
+///             the compiler as well (eg. `-mavx2` along with `Z4GE_FORCE_AVX2_INTRINSICS`).
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the 128 bit SSE2 vector implementations are enabled
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_SIMD_SSE2
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE2
+#        define Z4GE_SIMD_SSE2 Z4GE_ENABLE
+#    else
+#        define Z4GE_SIMD_SSE2 Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the 256 bit AVX2 vector implementations are enabled
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_SIMD_AVX2
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX2
+#        define Z4GE_SIMD_AVX2 Z4GE_ENABLE
+#    else
+#        define Z4GE_SIMD_AVX2 Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the 512 bit AVX-512 F (32-bit lanes) vector implementations are enabled
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_SIMD_AVX512F
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX512F
+#        define Z4GE_SIMD_AVX512F Z4GE_ENABLE
+#    else
+#        define Z4GE_SIMD_AVX512F Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the 512 bit AVX-512 BW (8-bit lanes) vector implementations are enabled
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_SIMD_AVX512BW
+#    if Z4GE_SIMD_AVX512F && (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX512BW)
+#        define Z4GE_SIMD_AVX512BW Z4GE_ENABLE
+#    else
+#        define Z4GE_SIMD_AVX512BW Z4GE_DISABLE
+#    endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief      Whether the 128 bit ARM NEON vector implementations are enabled
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef Z4GE_SIMD_NEON
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_NEON
+#        define Z4GE_SIMD_NEON Z4GE_ENABLE
+#    else
+#        define Z4GE_SIMD_NEON Z4GE_DISABLE
+#    endif
+#endif
+
+#if Z4GE_SIMD_AVX2 || Z4GE_SIMD_AVX512F
+#    include <immintrin.h>
+#elif Z4GE_SIMD_SSE2
+#    include <emmintrin.h>
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE41
+#        include <smmintrin.h>
+#    endif
+#endif
+#if Z4GE_SIMD_NEON
+#    include <arm_neon.h>
+#endif
+
+namespace Z4GE { namespace Simd {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @namespace  Z4GE::Simd
+    /// @brief      Portable fixed-width SIMD vector types
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename T, std::size_t N>
+    class Mask;
+
+    template<typename T, std::size_t N>
+    class Vector;
+
+    namespace Detail {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      The type produced by `ReduceAdd`. Sums of 8-bit lanes are widened to 32 bits
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename T>
+        struct SumType {
+            typedef T Type;
+        };
+
+        template<>
+        struct SumType<std::int8_t> {
+            typedef std::int32_t Type;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Scalar horizontal minimum / maximum for the lane types that lack a native reduction
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template<typename T, std::size_t N>
+        inline T ReduceMinScalar (const T (&Values)[N]) Z4GE_NOEXCEPT {
+            T Result = Values[0];
+            for (std::size_t Index = 1; Index < N; ++Index) {
+                Result = Values[Index] < Result ? Values[Index] : Result;
+            }
+            return Result;
+        }
+
+        template<typename T, std::size_t N>
+        inline T ReduceMaxScalar (const T (&Values)[N]) Z4GE_NOEXCEPT {
+            T Result = Values[0];
+            for (std::size_t Index = 1; Index < N; ++Index) {
+                Result = Values[Index] > Result ? Values[Index] : Result;
+            }
+            return Result;
+        }
+
+    } // namespace Detail
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Portable (scalar) lane mask
+    /// @details    This is the fallback implementation of a lane mask, used when no native implementation is enabled for the
+    ///             lane type @p T and lane count @p N.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t N>
+    class Mask {
+    public:
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = N;
+
+        bool Values[N];
+
+        friend Mask operator& (const Mask& Lhs, const Mask& Rhs) Z4GE_NOEXCEPT {
+            Mask Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = Lhs.Values[Index] && Rhs.Values[Index];
+            return Result;
+        }
+
+        friend Mask operator| (const Mask& Lhs, const Mask& Rhs) Z4GE_NOEXCEPT {
+            Mask Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = Lhs.Values[Index] || Rhs.Values[Index];
+            return Result;
+        }
+
+        friend Mask operator^ (const Mask& Lhs, const Mask& Rhs) Z4GE_NOEXCEPT {
+            Mask Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = Lhs.Values[Index] != Rhs.Values[Index];
+            return Result;
+        }
+
+        friend Mask operator~(const Mask& Operand) Z4GE_NOEXCEPT {
+            Mask Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = !Operand.Values[Index];
+            return Result;
+        }
+
+        /// @brief  Bit `i` of the result is set if lane `i` is set
+        std::uint64_t ToBits (void) const Z4GE_NOEXCEPT {
+            std::uint64_t Bits = 0;
+            for (std::size_t Index = 0; Index < N; ++Index) Bits |= static_cast<std::uint64_t> (Values[Index]) << Index;
+            return Bits;
+        }
+
+        bool Any (void) const Z4GE_NOEXCEPT { return ToBits () != 0; }
+        bool All (void) const Z4GE_NOEXCEPT { return ToBits () == (~std::uint64_t (0) >> (64 - N)); }
+        bool None (void) const Z4GE_NOEXCEPT { return ToBits () == 0; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Portable (scalar) fixed-width vector
+    /// @details    This is the fallback implementation of a vector, used when no native implementation is enabled for the
+    ///             lane type @p T and lane count @p N. Operations are implemented as fixed trip-count loops, which leaves
+    ///             the compiler free to auto-vectorize them.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t N>
+    class Vector {
+    public:
+        typedef T                                 ValueType;
+        typedef typename Detail::SumType<T>::Type SumType;
+        typedef Mask<T, N>                        MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = N;
+
+        Z4GE_ALIGN_AS (sizeof (T) * N) T Values[N];
+
+        Vector (void) Z4GE_DEFAULT;
+        explicit Vector (T Value) Z4GE_NOEXCEPT {
+            for (std::size_t Index = 0; Index < N; ++Index) Values[Index] = Value;
+        }
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return Vector (T (0)); }
+
+        static Vector Load (const T* Source) Z4GE_NOEXCEPT {
+            Vector Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = Source[Index];
+            return Result;
+        }
+
+        static Vector LoadAligned (const T* Source) Z4GE_NOEXCEPT { return Load (Source); }
+
+        void Store (T* Destination) const Z4GE_NOEXCEPT {
+            for (std::size_t Index = 0; Index < N; ++Index) Destination[Index] = Values[Index];
+        }
+
+        void StoreAligned (T* Destination) const Z4GE_NOEXCEPT { Store (Destination); }
+
+        T operator[] (std::size_t Index) const Z4GE_NOEXCEPT { return Values[Index]; }
+
+        template<unsigned I0, unsigned I1, unsigned I2, unsigned I3>
+        Vector Shuffle (void) const Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (sizeof (T) == 4 && N % 4 == 0, "Shuffle is only available for 32-bit lanes");
+            Z4GE_STATIC_ASSERT (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Shuffle indices must be within [0, 4)");
+            Vector Result;
+            for (std::size_t Group = 0; Group < N; Group += 4) {
+                Result.Values[Group + 0] = Values[Group + I0];
+                Result.Values[Group + 1] = Values[Group + I1];
+                Result.Values[Group + 2] = Values[Group + I2];
+                Result.Values[Group + 3] = Values[Group + I3];
+            }
+            return Result;
+        }
+
+        SumType ReduceAdd (void) const Z4GE_NOEXCEPT {
+            SumType Result = SumType (0);
+            for (std::size_t Index = 0; Index < N; ++Index) Result = static_cast<SumType> (Result + Values[Index]);
+            return Result;
+        }
+
+        T ReduceMin (void) const Z4GE_NOEXCEPT { return Detail::ReduceMinScalar (Values); }
+        T ReduceMax (void) const Z4GE_NOEXCEPT { return Detail::ReduceMaxScalar (Values); }
+
+        friend Vector operator+ (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            Vector Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = T (Lhs.Values[Index] + Rhs.Values[Index]);
+            return Result;
+        }
+
+        friend Vector operator- (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            Vector Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = T (Lhs.Values[Index] - Rhs.Values[Index]);
+            return Result;
+        }
+
+        friend Vector operator* (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (sizeof (T) > 1, "Multiplication is not available for 8-bit lanes");
+            Vector Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = T (Lhs.Values[Index] * Rhs.Values[Index]);
+            return Result;
+        }
+
+        friend Vector operator/ (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (std::is_floating_point<T>::value, "Division is only available for floating point lanes");
+            Vector Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = T (Lhs.Values[Index] / Rhs.Values[Index]);
+            return Result;
+        }
+
+        friend MaskType operator== (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            MaskType Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = Lhs.Values[Index] == Rhs.Values[Index];
+            return Result;
+        }
+
+        friend MaskType operator!= (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            MaskType Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = Lhs.Values[Index] != Rhs.Values[Index];
+            return Result;
+        }
+
+        friend MaskType operator< (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            MaskType Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = Lhs.Values[Index] < Rhs.Values[Index];
+            return Result;
+        }
+
+        friend MaskType operator<= (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            MaskType Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = Lhs.Values[Index] <= Rhs.Values[Index];
+            return Result;
+        }
+
+        friend MaskType operator> (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            MaskType Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = Lhs.Values[Index] > Rhs.Values[Index];
+            return Result;
+        }
+
+        friend MaskType operator>= (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            MaskType Result;
+            for (std::size_t Index = 0; Index < N; ++Index) Result.Values[Index] = Lhs.Values[Index] >= Rhs.Values[Index];
+            return Result;
+        }
+
+        friend Vector Min (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            Vector Result;
+            for (std::size_t Index = 0; Index < N; ++Index) {
+                Result.Values[Index] = Rhs.Values[Index] < Lhs.Values[Index] ? Rhs.Values[Index] : Lhs.Values[Index];
+            }
+            return Result;
+        }
+
+        friend Vector Max (const Vector& Lhs, const Vector& Rhs) Z4GE_NOEXCEPT {
+            Vector Result;
+            for (std::size_t Index = 0; Index < N; ++Index) {
+                Result.Values[Index] = Lhs.Values[Index] < Rhs.Values[Index] ? Rhs.Values[Index] : Lhs.Values[Index];
+            }
+            return Result;
+        }
+
+        /// @brief  Lane `i` of the result is taken from @p WhenTrue if lane `i` of @p Selector is set, from @p WhenFalse
+        ///         otherwise
+        friend Vector Select (const MaskType& Selector, const Vector& WhenTrue, const Vector& WhenFalse) Z4GE_NOEXCEPT {
+            Vector Result;
+            for (std::size_t Index = 0; Index < N; ++Index) {
+                Result.Values[Index] = Selector.Values[Index] ? WhenTrue.Values[Index] : WhenFalse.Values[Index];
+            }
+            return Result;
+        }
+    };
+
+    /// @brief  4 x 32-bit floating point lanes
+    typedef Vector<float, 4> Float32x4;
+    /// @brief  8 x 32-bit floating point lanes
+    typedef Vector<float, 8> Float32x8;
+    /// @brief  16 x 32-bit floating point lanes
+    typedef Vector<float, 16> Float32x16;
+    /// @brief  4 x 32-bit signed integer lanes
+    typedef Vector<std::int32_t, 4> Int32x4;
+    /// @brief  8 x 32-bit signed integer lanes
+    typedef Vector<std::int32_t, 8> Int32x8;
+    /// @brief  16 x 32-bit signed integer lanes
+    typedef Vector<std::int32_t, 16> Int32x16;
+    /// @brief  16 x 8-bit signed integer lanes
+    typedef Vector<std::int8_t, 16> Int8x16;
+    /// @brief  32 x 8-bit signed integer lanes
+    typedef Vector<std::int8_t, 32> Int8x32;
+    /// @brief  64 x 8-bit signed integer lanes
+    typedef Vector<std::int8_t, 64> Int8x64;
+
+#if Z4GE_SIMD_SSE2
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      SSE2 mask for 4 x 32-bit floating point lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Mask<float, 4> {
+    public:
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 4;
+
+        __m128 Native;
+
+        Mask (void) Z4GE_DEFAULT;
+        Mask (__m128 Value) Z4GE_NOEXCEPT : Native (Value) {}
+
+        friend Mask operator& (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm_and_ps (Lhs.Native, Rhs.Native); }
+        friend Mask operator| (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm_or_ps (Lhs.Native, Rhs.Native); }
+        friend Mask operator^ (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm_xor_ps (Lhs.Native, Rhs.Native); }
+        friend Mask operator~(Mask Operand) Z4GE_NOEXCEPT {
+            return _mm_xor_ps (Operand.Native, _mm_castsi128_ps (_mm_set1_epi32 (-1)));
+        }
+
+        std::uint64_t ToBits (void) const Z4GE_NOEXCEPT { return static_cast<std::uint64_t> (_mm_movemask_ps (Native)); }
+        bool          Any (void) const Z4GE_NOEXCEPT { return ToBits () != 0; }
+        bool          All (void) const Z4GE_NOEXCEPT { return ToBits () == 0xFu; }
+        bool          None (void) const Z4GE_NOEXCEPT { return ToBits () == 0; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      SSE2 vector of 4 x 32-bit floating point lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<float, 4> {
+    public:
+        typedef float       ValueType;
+        typedef float       SumType;
+        typedef Mask<float, 4> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 4;
+
+        __m128 Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (__m128 Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (float Value) Z4GE_NOEXCEPT : Native (_mm_set1_ps (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return _mm_setzero_ps (); }
+        static Vector Load (const float* Source) Z4GE_NOEXCEPT { return _mm_loadu_ps (Source); }
+        static Vector LoadAligned (const float* Source) Z4GE_NOEXCEPT { return _mm_load_ps (Source); }
+        void          Store (float* Destination) const Z4GE_NOEXCEPT { _mm_storeu_ps (Destination, Native); }
+        void          StoreAligned (float* Destination) const Z4GE_NOEXCEPT { _mm_store_ps (Destination, Native); }
+
+        float operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (16) float Values[4];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        template<unsigned I0, unsigned I1, unsigned I2, unsigned I3>
+        Vector Shuffle (void) const Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Shuffle indices must be within [0, 4)");
+            return _mm_shuffle_ps (Native, Native, _MM_SHUFFLE (I3, I2, I1, I0));
+        }
+
+        float ReduceAdd (void) const Z4GE_NOEXCEPT {
+            const __m128 Pairs = _mm_add_ps (Native, _mm_movehl_ps (Native, Native));
+            return _mm_cvtss_f32 (_mm_add_ss (Pairs, _mm_shuffle_ps (Pairs, Pairs, _MM_SHUFFLE (1, 1, 1, 1))));
+        }
+
+        float ReduceMin (void) const Z4GE_NOEXCEPT {
+            const __m128 Pairs = _mm_min_ps (Native, _mm_movehl_ps (Native, Native));
+            return _mm_cvtss_f32 (_mm_min_ss (Pairs, _mm_shuffle_ps (Pairs, Pairs, _MM_SHUFFLE (1, 1, 1, 1))));
+        }
+
+        float ReduceMax (void) const Z4GE_NOEXCEPT {
+            const __m128 Pairs = _mm_max_ps (Native, _mm_movehl_ps (Native, Native));
+            return _mm_cvtss_f32 (_mm_max_ss (Pairs, _mm_shuffle_ps (Pairs, Pairs, _MM_SHUFFLE (1, 1, 1, 1))));
+        }
+
+        friend Vector   operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_add_ps (Lhs.Native, Rhs.Native); }
+        friend Vector   operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_sub_ps (Lhs.Native, Rhs.Native); }
+        friend Vector   operator* (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_mul_ps (Lhs.Native, Rhs.Native); }
+        friend Vector   operator/ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_div_ps (Lhs.Native, Rhs.Native); }
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmpeq_ps (Lhs.Native, Rhs.Native); }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmpneq_ps (Lhs.Native, Rhs.Native); }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmplt_ps (Lhs.Native, Rhs.Native); }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmple_ps (Lhs.Native, Rhs.Native); }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmpgt_ps (Lhs.Native, Rhs.Native); }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmpge_ps (Lhs.Native, Rhs.Native); }
+        friend Vector   Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_min_ps (Lhs.Native, Rhs.Native); }
+        friend Vector   Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_max_ps (Lhs.Native, Rhs.Native); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE41
+            return _mm_blendv_ps (WhenFalse.Native, WhenTrue.Native, Selector.Native);
+#    else
+            return _mm_or_ps (_mm_and_ps (Selector.Native, WhenTrue.Native), _mm_andnot_ps (Selector.Native, WhenFalse.Native));
+#    endif
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      SSE2 mask for 4 x 32-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Mask<std::int32_t, 4> {
+    public:
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 4;
+
+        __m128i Native;
+
+        Mask (void) Z4GE_DEFAULT;
+        Mask (__m128i Value) Z4GE_NOEXCEPT : Native (Value) {}
+
+        friend Mask operator& (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm_and_si128 (Lhs.Native, Rhs.Native); }
+        friend Mask operator| (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm_or_si128 (Lhs.Native, Rhs.Native); }
+        friend Mask operator^ (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm_xor_si128 (Lhs.Native, Rhs.Native); }
+        friend Mask operator~(Mask Operand) Z4GE_NOEXCEPT { return _mm_xor_si128 (Operand.Native, _mm_set1_epi32 (-1)); }
+
+        std::uint64_t ToBits (void) const Z4GE_NOEXCEPT {
+            return static_cast<std::uint64_t> (_mm_movemask_ps (_mm_castsi128_ps (Native)));
+        }
+        bool Any (void) const Z4GE_NOEXCEPT { return ToBits () != 0; }
+        bool All (void) const Z4GE_NOEXCEPT { return ToBits () == 0xFu; }
+        bool None (void) const Z4GE_NOEXCEPT { return ToBits () == 0; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      SSE2 vector of 4 x 32-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<std::int32_t, 4> {
+    public:
+        typedef std::int32_t          ValueType;
+        typedef std::int32_t          SumType;
+        typedef Mask<std::int32_t, 4> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 4;
+
+        __m128i Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (__m128i Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (std::int32_t Value) Z4GE_NOEXCEPT : Native (_mm_set1_epi32 (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return _mm_setzero_si128 (); }
+        static Vector Load (const std::int32_t* Source) Z4GE_NOEXCEPT {
+            return _mm_loadu_si128 (reinterpret_cast<const __m128i*> (Source));
+        }
+        static Vector LoadAligned (const std::int32_t* Source) Z4GE_NOEXCEPT {
+            return _mm_load_si128 (reinterpret_cast<const __m128i*> (Source));
+        }
+        void Store (std::int32_t* Destination) const Z4GE_NOEXCEPT {
+            _mm_storeu_si128 (reinterpret_cast<__m128i*> (Destination), Native);
+        }
+        void StoreAligned (std::int32_t* Destination) const Z4GE_NOEXCEPT {
+            _mm_store_si128 (reinterpret_cast<__m128i*> (Destination), Native);
+        }
+
+        std::int32_t operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (16) std::int32_t Values[4];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        template<unsigned I0, unsigned I1, unsigned I2, unsigned I3>
+        Vector Shuffle (void) const Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Shuffle indices must be within [0, 4)");
+            return _mm_shuffle_epi32 (Native, _MM_SHUFFLE (I3, I2, I1, I0));
+        }
+
+        std::int32_t ReduceAdd (void) const Z4GE_NOEXCEPT {
+            const Vector Pairs = *this + Shuffle<2, 3, 0, 1> ();
+            return _mm_cvtsi128_si32 ((Pairs + Pairs.Shuffle<1, 0, 3, 2> ()).Native);
+        }
+
+        std::int32_t ReduceMin (void) const Z4GE_NOEXCEPT {
+            const Vector Pairs = Min (*this, Shuffle<2, 3, 0, 1> ());
+            return _mm_cvtsi128_si32 (Min (Pairs, Pairs.Shuffle<1, 0, 3, 2> ()).Native);
+        }
+
+        std::int32_t ReduceMax (void) const Z4GE_NOEXCEPT {
+            const Vector Pairs = Max (*this, Shuffle<2, 3, 0, 1> ());
+            return _mm_cvtsi128_si32 (Max (Pairs, Pairs.Shuffle<1, 0, 3, 2> ()).Native);
+        }
+
+        friend Vector operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_add_epi32 (Lhs.Native, Rhs.Native); }
+        friend Vector operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_sub_epi32 (Lhs.Native, Rhs.Native); }
+
+        friend Vector operator* (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE41
+            return _mm_mullo_epi32 (Lhs.Native, Rhs.Native);
+#    else
+            //  SSE2 only multiplies the even lanes (into 64 bits); multiply the odd lanes separately and interleave
+            const __m128i Even = _mm_mul_epu32 (Lhs.Native, Rhs.Native);
+            const __m128i Odd  = _mm_mul_epu32 (_mm_srli_epi64 (Lhs.Native, 32), _mm_srli_epi64 (Rhs.Native, 32));
+            return _mm_unpacklo_epi32 (_mm_shuffle_epi32 (Even, _MM_SHUFFLE (0, 0, 2, 0)),
+                                       _mm_shuffle_epi32 (Odd, _MM_SHUFFLE (0, 0, 2, 0)));
+#    endif
+        }
+
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmpeq_epi32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs == Rhs); }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmplt_epi32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs > Rhs); }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmpgt_epi32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs < Rhs); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE41
+            return _mm_blendv_epi8 (WhenFalse.Native, WhenTrue.Native, Selector.Native);
+#    else
+            return _mm_or_si128 (_mm_and_si128 (Selector.Native, WhenTrue.Native),
+                                 _mm_andnot_si128 (Selector.Native, WhenFalse.Native));
+#    endif
+        }
+
+        friend Vector Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE41
+            return _mm_min_epi32 (Lhs.Native, Rhs.Native);
+#    else
+            return Select (Rhs < Lhs, Rhs, Lhs);
+#    endif
+        }
+
+        friend Vector Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE41
+            return _mm_max_epi32 (Lhs.Native, Rhs.Native);
+#    else
+            return Select (Lhs < Rhs, Rhs, Lhs);
+#    endif
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      SSE2 mask for 16 x 8-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Mask<std::int8_t, 16> {
+    public:
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 16;
+
+        __m128i Native;
+
+        Mask (void) Z4GE_DEFAULT;
+        Mask (__m128i Value) Z4GE_NOEXCEPT : Native (Value) {}
+
+        friend Mask operator& (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm_and_si128 (Lhs.Native, Rhs.Native); }
+        friend Mask operator| (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm_or_si128 (Lhs.Native, Rhs.Native); }
+        friend Mask operator^ (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm_xor_si128 (Lhs.Native, Rhs.Native); }
+        friend Mask operator~(Mask Operand) Z4GE_NOEXCEPT { return _mm_xor_si128 (Operand.Native, _mm_set1_epi32 (-1)); }
+
+        std::uint64_t ToBits (void) const Z4GE_NOEXCEPT { return static_cast<std::uint64_t> (_mm_movemask_epi8 (Native)); }
+        bool          Any (void) const Z4GE_NOEXCEPT { return ToBits () != 0; }
+        bool          All (void) const Z4GE_NOEXCEPT { return ToBits () == 0xFFFFu; }
+        bool          None (void) const Z4GE_NOEXCEPT { return ToBits () == 0; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      SSE2 vector of 16 x 8-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<std::int8_t, 16> {
+    public:
+        typedef std::int8_t           ValueType;
+        typedef std::int32_t          SumType;
+        typedef Mask<std::int8_t, 16> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 16;
+
+        __m128i Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (__m128i Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (std::int8_t Value) Z4GE_NOEXCEPT : Native (_mm_set1_epi8 (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return _mm_setzero_si128 (); }
+        static Vector Load (const std::int8_t* Source) Z4GE_NOEXCEPT {
+            return _mm_loadu_si128 (reinterpret_cast<const __m128i*> (Source));
+        }
+        static Vector LoadAligned (const std::int8_t* Source) Z4GE_NOEXCEPT {
+            return _mm_load_si128 (reinterpret_cast<const __m128i*> (Source));
+        }
+        void Store (std::int8_t* Destination) const Z4GE_NOEXCEPT {
+            _mm_storeu_si128 (reinterpret_cast<__m128i*> (Destination), Native);
+        }
+        void StoreAligned (std::int8_t* Destination) const Z4GE_NOEXCEPT {
+            _mm_store_si128 (reinterpret_cast<__m128i*> (Destination), Native);
+        }
+
+        std::int8_t operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (16) std::int8_t Values[16];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        std::int32_t ReduceAdd (void) const Z4GE_NOEXCEPT {
+            //  Bias the signed lanes into [0, 255] and sum them with the sum of absolute differences against zero
+            const __m128i Sums = _mm_sad_epu8 (_mm_xor_si128 (Native, _mm_set1_epi8 (-128)), _mm_setzero_si128 ());
+            return _mm_cvtsi128_si32 (Sums) + _mm_cvtsi128_si32 (_mm_srli_si128 (Sums, 8)) - 128 * 16;
+        }
+
+        std::int8_t ReduceMin (void) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (16) std::int8_t Values[16];
+            StoreAligned (Values);
+            return Detail::ReduceMinScalar (Values);
+        }
+
+        std::int8_t ReduceMax (void) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (16) std::int8_t Values[16];
+            StoreAligned (Values);
+            return Detail::ReduceMaxScalar (Values);
+        }
+
+        friend Vector   operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_add_epi8 (Lhs.Native, Rhs.Native); }
+        friend Vector   operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_sub_epi8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmpeq_epi8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs == Rhs); }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmplt_epi8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs > Rhs); }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm_cmpgt_epi8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs < Rhs); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE41
+            return _mm_blendv_epi8 (WhenFalse.Native, WhenTrue.Native, Selector.Native);
+#    else
+            return _mm_or_si128 (_mm_and_si128 (Selector.Native, WhenTrue.Native),
+                                 _mm_andnot_si128 (Selector.Native, WhenFalse.Native));
+#    endif
+        }
+
+        friend Vector Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE41
+            return _mm_min_epi8 (Lhs.Native, Rhs.Native);
+#    else
+            return Select (Rhs < Lhs, Rhs, Lhs);
+#    endif
+        }
+
+        friend Vector Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+#    if Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_SSE41
+            return _mm_max_epi8 (Lhs.Native, Rhs.Native);
+#    else
+            return Select (Lhs < Rhs, Rhs, Lhs);
+#    endif
+        }
+    };
+#endif
+
+#if Z4GE_SIMD_AVX2
+    namespace Detail {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Horizontal reductions of the low / high halves of a 256 bit vector, shared by the AVX2 vectors
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline float ReduceAdd128 (__m128 Value) Z4GE_NOEXCEPT {
+            const __m128 Pairs = _mm_add_ps (Value, _mm_movehl_ps (Value, Value));
+            return _mm_cvtss_f32 (_mm_add_ss (Pairs, _mm_shuffle_ps (Pairs, Pairs, _MM_SHUFFLE (1, 1, 1, 1))));
+        }
+
+        inline float ReduceMin128 (__m128 Value) Z4GE_NOEXCEPT {
+            const __m128 Pairs = _mm_min_ps (Value, _mm_movehl_ps (Value, Value));
+            return _mm_cvtss_f32 (_mm_min_ss (Pairs, _mm_shuffle_ps (Pairs, Pairs, _MM_SHUFFLE (1, 1, 1, 1))));
+        }
+
+        inline float ReduceMax128 (__m128 Value) Z4GE_NOEXCEPT {
+            const __m128 Pairs = _mm_max_ps (Value, _mm_movehl_ps (Value, Value));
+            return _mm_cvtss_f32 (_mm_max_ss (Pairs, _mm_shuffle_ps (Pairs, Pairs, _MM_SHUFFLE (1, 1, 1, 1))));
+        }
+
+        inline std::int32_t ReduceAdd128 (__m128i Value) Z4GE_NOEXCEPT {
+            const __m128i Pairs = _mm_add_epi32 (Value, _mm_shuffle_epi32 (Value, _MM_SHUFFLE (1, 0, 3, 2)));
+            return _mm_cvtsi128_si32 (_mm_add_epi32 (Pairs, _mm_shuffle_epi32 (Pairs, _MM_SHUFFLE (2, 3, 0, 1))));
+        }
+
+        inline std::int32_t ReduceMin128 (__m128i Value) Z4GE_NOEXCEPT {
+            const __m128i Pairs = _mm_min_epi32 (Value, _mm_shuffle_epi32 (Value, _MM_SHUFFLE (1, 0, 3, 2)));
+            return _mm_cvtsi128_si32 (_mm_min_epi32 (Pairs, _mm_shuffle_epi32 (Pairs, _MM_SHUFFLE (2, 3, 0, 1))));
+        }
+
+        inline std::int32_t ReduceMax128 (__m128i Value) Z4GE_NOEXCEPT {
+            const __m128i Pairs = _mm_max_epi32 (Value, _mm_shuffle_epi32 (Value, _MM_SHUFFLE (1, 0, 3, 2)));
+            return _mm_cvtsi128_si32 (_mm_max_epi32 (Pairs, _mm_shuffle_epi32 (Pairs, _MM_SHUFFLE (2, 3, 0, 1))));
+        }
+
+    } // namespace Detail
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      AVX2 mask for 8 x 32-bit floating point lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Mask<float, 8> {
+    public:
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 8;
+
+        __m256 Native;
+
+        Mask (void) Z4GE_DEFAULT;
+        Mask (__m256 Value) Z4GE_NOEXCEPT : Native (Value) {}
+
+        friend Mask operator& (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm256_and_ps (Lhs.Native, Rhs.Native); }
+        friend Mask operator| (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm256_or_ps (Lhs.Native, Rhs.Native); }
+        friend Mask operator^ (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm256_xor_ps (Lhs.Native, Rhs.Native); }
+        friend Mask operator~(Mask Operand) Z4GE_NOEXCEPT {
+            return _mm256_xor_ps (Operand.Native, _mm256_castsi256_ps (_mm256_set1_epi32 (-1)));
+        }
+
+        std::uint64_t ToBits (void) const Z4GE_NOEXCEPT { return static_cast<std::uint64_t> (_mm256_movemask_ps (Native)); }
+        bool          Any (void) const Z4GE_NOEXCEPT { return ToBits () != 0; }
+        bool          All (void) const Z4GE_NOEXCEPT { return ToBits () == 0xFFu; }
+        bool          None (void) const Z4GE_NOEXCEPT { return ToBits () == 0; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      AVX2 vector of 8 x 32-bit floating point lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<float, 8> {
+    public:
+        typedef float          ValueType;
+        typedef float          SumType;
+        typedef Mask<float, 8> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 8;
+
+        __m256 Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (__m256 Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (float Value) Z4GE_NOEXCEPT : Native (_mm256_set1_ps (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return _mm256_setzero_ps (); }
+        static Vector Load (const float* Source) Z4GE_NOEXCEPT { return _mm256_loadu_ps (Source); }
+        static Vector LoadAligned (const float* Source) Z4GE_NOEXCEPT { return _mm256_load_ps (Source); }
+        void          Store (float* Destination) const Z4GE_NOEXCEPT { _mm256_storeu_ps (Destination, Native); }
+        void          StoreAligned (float* Destination) const Z4GE_NOEXCEPT { _mm256_store_ps (Destination, Native); }
+
+        float operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (32) float Values[8];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        template<unsigned I0, unsigned I1, unsigned I2, unsigned I3>
+        Vector Shuffle (void) const Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Shuffle indices must be within [0, 4)");
+            return _mm256_permute_ps (Native, _MM_SHUFFLE (I3, I2, I1, I0));
+        }
+
+        float ReduceAdd (void) const Z4GE_NOEXCEPT {
+            return Detail::ReduceAdd128 (_mm_add_ps (_mm256_castps256_ps128 (Native), _mm256_extractf128_ps (Native, 1)));
+        }
+
+        float ReduceMin (void) const Z4GE_NOEXCEPT {
+            return Detail::ReduceMin128 (_mm_min_ps (_mm256_castps256_ps128 (Native), _mm256_extractf128_ps (Native, 1)));
+        }
+
+        float ReduceMax (void) const Z4GE_NOEXCEPT {
+            return Detail::ReduceMax128 (_mm_max_ps (_mm256_castps256_ps128 (Native), _mm256_extractf128_ps (Native, 1)));
+        }
+
+        friend Vector operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_add_ps (Lhs.Native, Rhs.Native); }
+        friend Vector operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_sub_ps (Lhs.Native, Rhs.Native); }
+        friend Vector operator* (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_mul_ps (Lhs.Native, Rhs.Native); }
+        friend Vector operator/ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_div_ps (Lhs.Native, Rhs.Native); }
+
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm256_cmp_ps (Lhs.Native, Rhs.Native, _CMP_EQ_OQ);
+        }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm256_cmp_ps (Lhs.Native, Rhs.Native, _CMP_NEQ_UQ);
+        }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm256_cmp_ps (Lhs.Native, Rhs.Native, _CMP_LT_OQ);
+        }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm256_cmp_ps (Lhs.Native, Rhs.Native, _CMP_LE_OQ);
+        }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm256_cmp_ps (Lhs.Native, Rhs.Native, _CMP_GT_OQ);
+        }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm256_cmp_ps (Lhs.Native, Rhs.Native, _CMP_GE_OQ);
+        }
+
+        friend Vector Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_min_ps (Lhs.Native, Rhs.Native); }
+        friend Vector Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_max_ps (Lhs.Native, Rhs.Native); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+            return _mm256_blendv_ps (WhenFalse.Native, WhenTrue.Native, Selector.Native);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      AVX2 mask for 8 x 32-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Mask<std::int32_t, 8> {
+    public:
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 8;
+
+        __m256i Native;
+
+        Mask (void) Z4GE_DEFAULT;
+        Mask (__m256i Value) Z4GE_NOEXCEPT : Native (Value) {}
+
+        friend Mask operator& (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm256_and_si256 (Lhs.Native, Rhs.Native); }
+        friend Mask operator| (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm256_or_si256 (Lhs.Native, Rhs.Native); }
+        friend Mask operator^ (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm256_xor_si256 (Lhs.Native, Rhs.Native); }
+        friend Mask operator~(Mask Operand) Z4GE_NOEXCEPT { return _mm256_xor_si256 (Operand.Native, _mm256_set1_epi32 (-1)); }
+
+        std::uint64_t ToBits (void) const Z4GE_NOEXCEPT {
+            return static_cast<std::uint64_t> (_mm256_movemask_ps (_mm256_castsi256_ps (Native)));
+        }
+        bool Any (void) const Z4GE_NOEXCEPT { return ToBits () != 0; }
+        bool All (void) const Z4GE_NOEXCEPT { return ToBits () == 0xFFu; }
+        bool None (void) const Z4GE_NOEXCEPT { return ToBits () == 0; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      AVX2 vector of 8 x 32-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<std::int32_t, 8> {
+    public:
+        typedef std::int32_t          ValueType;
+        typedef std::int32_t          SumType;
+        typedef Mask<std::int32_t, 8> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 8;
+
+        __m256i Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (__m256i Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (std::int32_t Value) Z4GE_NOEXCEPT : Native (_mm256_set1_epi32 (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return _mm256_setzero_si256 (); }
+        static Vector Load (const std::int32_t* Source) Z4GE_NOEXCEPT {
+            return _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (Source));
+        }
+        static Vector LoadAligned (const std::int32_t* Source) Z4GE_NOEXCEPT {
+            return _mm256_load_si256 (reinterpret_cast<const __m256i*> (Source));
+        }
+        void Store (std::int32_t* Destination) const Z4GE_NOEXCEPT {
+            _mm256_storeu_si256 (reinterpret_cast<__m256i*> (Destination), Native);
+        }
+        void StoreAligned (std::int32_t* Destination) const Z4GE_NOEXCEPT {
+            _mm256_store_si256 (reinterpret_cast<__m256i*> (Destination), Native);
+        }
+
+        std::int32_t operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (32) std::int32_t Values[8];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        template<unsigned I0, unsigned I1, unsigned I2, unsigned I3>
+        Vector Shuffle (void) const Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Shuffle indices must be within [0, 4)");
+            return _mm256_shuffle_epi32 (Native, _MM_SHUFFLE (I3, I2, I1, I0));
+        }
+
+        std::int32_t ReduceAdd (void) const Z4GE_NOEXCEPT {
+            return Detail::ReduceAdd128 (
+              _mm_add_epi32 (_mm256_castsi256_si128 (Native), _mm256_extracti128_si256 (Native, 1)));
+        }
+
+        std::int32_t ReduceMin (void) const Z4GE_NOEXCEPT {
+            return Detail::ReduceMin128 (
+              _mm_min_epi32 (_mm256_castsi256_si128 (Native), _mm256_extracti128_si256 (Native, 1)));
+        }
+
+        std::int32_t ReduceMax (void) const Z4GE_NOEXCEPT {
+            return Detail::ReduceMax128 (
+              _mm_max_epi32 (_mm256_castsi256_si128 (Native), _mm256_extracti128_si256 (Native, 1)));
+        }
+
+        friend Vector operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_add_epi32 (Lhs.Native, Rhs.Native); }
+        friend Vector operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_sub_epi32 (Lhs.Native, Rhs.Native); }
+        friend Vector operator* (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_mullo_epi32 (Lhs.Native, Rhs.Native); }
+
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm256_cmpeq_epi32 (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs == Rhs); }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_cmpgt_epi32 (Rhs.Native, Lhs.Native); }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs > Rhs); }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_cmpgt_epi32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs < Rhs); }
+
+        friend Vector Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_min_epi32 (Lhs.Native, Rhs.Native); }
+        friend Vector Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_max_epi32 (Lhs.Native, Rhs.Native); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+            return _mm256_blendv_epi8 (WhenFalse.Native, WhenTrue.Native, Selector.Native);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      AVX2 mask for 32 x 8-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Mask<std::int8_t, 32> {
+    public:
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 32;
+
+        __m256i Native;
+
+        Mask (void) Z4GE_DEFAULT;
+        Mask (__m256i Value) Z4GE_NOEXCEPT : Native (Value) {}
+
+        friend Mask operator& (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm256_and_si256 (Lhs.Native, Rhs.Native); }
+        friend Mask operator| (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm256_or_si256 (Lhs.Native, Rhs.Native); }
+        friend Mask operator^ (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return _mm256_xor_si256 (Lhs.Native, Rhs.Native); }
+        friend Mask operator~(Mask Operand) Z4GE_NOEXCEPT { return _mm256_xor_si256 (Operand.Native, _mm256_set1_epi32 (-1)); }
+
+        std::uint64_t ToBits (void) const Z4GE_NOEXCEPT {
+            return static_cast<std::uint32_t> (_mm256_movemask_epi8 (Native));
+        }
+        bool Any (void) const Z4GE_NOEXCEPT { return ToBits () != 0; }
+        bool All (void) const Z4GE_NOEXCEPT { return ToBits () == 0xFFFFFFFFu; }
+        bool None (void) const Z4GE_NOEXCEPT { return ToBits () == 0; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      AVX2 vector of 32 x 8-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<std::int8_t, 32> {
+    public:
+        typedef std::int8_t           ValueType;
+        typedef std::int32_t          SumType;
+        typedef Mask<std::int8_t, 32> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 32;
+
+        __m256i Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (__m256i Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (std::int8_t Value) Z4GE_NOEXCEPT : Native (_mm256_set1_epi8 (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return _mm256_setzero_si256 (); }
+        static Vector Load (const std::int8_t* Source) Z4GE_NOEXCEPT {
+            return _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (Source));
+        }
+        static Vector LoadAligned (const std::int8_t* Source) Z4GE_NOEXCEPT {
+            return _mm256_load_si256 (reinterpret_cast<const __m256i*> (Source));
+        }
+        void Store (std::int8_t* Destination) const Z4GE_NOEXCEPT {
+            _mm256_storeu_si256 (reinterpret_cast<__m256i*> (Destination), Native);
+        }
+        void StoreAligned (std::int8_t* Destination) const Z4GE_NOEXCEPT {
+            _mm256_store_si256 (reinterpret_cast<__m256i*> (Destination), Native);
+        }
+
+        std::int8_t operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (32) std::int8_t Values[32];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        std::int32_t ReduceAdd (void) const Z4GE_NOEXCEPT {
+            //  Bias the signed lanes into [0, 255] and sum them with the sum of absolute differences against zero
+            const __m256i Sums = _mm256_sad_epu8 (_mm256_xor_si256 (Native, _mm256_set1_epi8 (-128)), _mm256_setzero_si256 ());
+            const __m128i Half = _mm_add_epi64 (_mm256_castsi256_si128 (Sums), _mm256_extracti128_si256 (Sums, 1));
+            return _mm_cvtsi128_si32 (Half) + _mm_cvtsi128_si32 (_mm_srli_si128 (Half, 8)) - 128 * 32;
+        }
+
+        std::int8_t ReduceMin (void) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (32) std::int8_t Values[32];
+            StoreAligned (Values);
+            return Detail::ReduceMinScalar (Values);
+        }
+
+        std::int8_t ReduceMax (void) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (32) std::int8_t Values[32];
+            StoreAligned (Values);
+            return Detail::ReduceMaxScalar (Values);
+        }
+
+        friend Vector operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_add_epi8 (Lhs.Native, Rhs.Native); }
+        friend Vector operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_sub_epi8 (Lhs.Native, Rhs.Native); }
+
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_cmpeq_epi8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs == Rhs); }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_cmpgt_epi8 (Rhs.Native, Lhs.Native); }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs > Rhs); }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_cmpgt_epi8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs < Rhs); }
+
+        friend Vector Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_min_epi8 (Lhs.Native, Rhs.Native); }
+        friend Vector Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm256_max_epi8 (Lhs.Native, Rhs.Native); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+            return _mm256_blendv_epi8 (WhenFalse.Native, WhenTrue.Native, Selector.Native);
+        }
+    };
+#endif
+
+#if Z4GE_SIMD_AVX512F
+    //  The AVX-512 intrinsics of GCC 12.1 / 12.2 pass a self-initialized `_mm512_undefined_*` value as the merge source,
+    //  which -Wuninitialized / -Wmaybe-uninitialized report at every inlined call (GCC PR 105593)
+#    if Z4GE_COMPILER & Z4GE_COMPILER_GCC && Z4GE_COMPILER_VERSION >= 120000 && Z4GE_COMPILER_VERSION < 120300
+#        pragma GCC diagnostic push
+#        pragma GCC diagnostic ignored "-Wuninitialized"
+#        pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#        define Z4GE_SIMD_AVX512_DIAGNOSTIC_PUSHED
+#    endif
+
+    namespace Detail {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      High 256 bits of a 512 bit vector, for the horizontal reductions. AVX-512 F only extracts 64-bit
+        ///             lanes, the 32-bit lane extraction requires AVX-512 DQ
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline __m256 High256 (__m512 Value) Z4GE_NOEXCEPT {
+            return _mm256_castpd_ps (_mm512_extractf64x4_pd (_mm512_castps_pd (Value), 1));
+        }
+
+        inline __m256i High256 (__m512i Value) Z4GE_NOEXCEPT { return _mm512_extracti64x4_epi64 (Value, 1); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      AVX-512 mask for 16 lanes, shared by the 32-bit lane vectors
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class Mask16 {
+        public:
+            static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 16;
+
+            __mmask16 Native;
+
+            Mask16 (void) Z4GE_DEFAULT;
+            Mask16 (__mmask16 Value) Z4GE_NOEXCEPT : Native (Value) {}
+
+            friend Mask16 operator& (Mask16 Lhs, Mask16 Rhs) Z4GE_NOEXCEPT {
+                return static_cast<__mmask16> (Lhs.Native & Rhs.Native);
+            }
+            friend Mask16 operator| (Mask16 Lhs, Mask16 Rhs) Z4GE_NOEXCEPT {
+                return static_cast<__mmask16> (Lhs.Native | Rhs.Native);
+            }
+            friend Mask16 operator^ (Mask16 Lhs, Mask16 Rhs) Z4GE_NOEXCEPT {
+                return static_cast<__mmask16> (Lhs.Native ^ Rhs.Native);
+            }
+            friend Mask16 operator~(Mask16 Operand) Z4GE_NOEXCEPT { return static_cast<__mmask16> (~Operand.Native); }
+
+            std::uint64_t ToBits (void) const Z4GE_NOEXCEPT { return Native; }
+            bool          Any (void) const Z4GE_NOEXCEPT { return Native != 0; }
+            bool          All (void) const Z4GE_NOEXCEPT { return Native == 0xFFFFu; }
+            bool          None (void) const Z4GE_NOEXCEPT { return Native == 0; }
+        };
+
+    } // namespace Detail
+
+    template<>
+    class Mask<float, 16> : public Detail::Mask16 {
+    public:
+        Mask (void) Z4GE_DEFAULT;
+        Mask (Detail::Mask16 Value) Z4GE_NOEXCEPT : Detail::Mask16 (Value) {}
+        Mask (__mmask16 Value) Z4GE_NOEXCEPT : Detail::Mask16 (Value) {}
+    };
+
+    template<>
+    class Mask<std::int32_t, 16> : public Detail::Mask16 {
+    public:
+        Mask (void) Z4GE_DEFAULT;
+        Mask (Detail::Mask16 Value) Z4GE_NOEXCEPT : Detail::Mask16 (Value) {}
+        Mask (__mmask16 Value) Z4GE_NOEXCEPT : Detail::Mask16 (Value) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      AVX-512 F vector of 16 x 32-bit floating point lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<float, 16> {
+    public:
+        typedef float           ValueType;
+        typedef float           SumType;
+        typedef Mask<float, 16> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 16;
+
+        __m512 Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (__m512 Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (float Value) Z4GE_NOEXCEPT : Native (_mm512_set1_ps (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return _mm512_setzero_ps (); }
+        static Vector Load (const float* Source) Z4GE_NOEXCEPT { return _mm512_loadu_ps (Source); }
+        static Vector LoadAligned (const float* Source) Z4GE_NOEXCEPT { return _mm512_load_ps (Source); }
+        void          Store (float* Destination) const Z4GE_NOEXCEPT { _mm512_storeu_ps (Destination, Native); }
+        void          StoreAligned (float* Destination) const Z4GE_NOEXCEPT { _mm512_store_ps (Destination, Native); }
+
+        float operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (64) float Values[16];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        template<unsigned I0, unsigned I1, unsigned I2, unsigned I3>
+        Vector Shuffle (void) const Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Shuffle indices must be within [0, 4)");
+            return _mm512_permute_ps (Native, _MM_SHUFFLE (I3, I2, I1, I0));
+        }
+
+        float ReduceAdd (void) const Z4GE_NOEXCEPT {
+            const __m256 Half = _mm256_add_ps (_mm512_castps512_ps256 (Native), Detail::High256 (Native));
+            return Detail::ReduceAdd128 (_mm_add_ps (_mm256_castps256_ps128 (Half), _mm256_extractf128_ps (Half, 1)));
+        }
+
+        float ReduceMin (void) const Z4GE_NOEXCEPT {
+            const __m256 Half = _mm256_min_ps (_mm512_castps512_ps256 (Native), Detail::High256 (Native));
+            return Detail::ReduceMin128 (_mm_min_ps (_mm256_castps256_ps128 (Half), _mm256_extractf128_ps (Half, 1)));
+        }
+
+        float ReduceMax (void) const Z4GE_NOEXCEPT {
+            const __m256 Half = _mm256_max_ps (_mm512_castps512_ps256 (Native), Detail::High256 (Native));
+            return Detail::ReduceMax128 (_mm_max_ps (_mm256_castps256_ps128 (Half), _mm256_extractf128_ps (Half, 1)));
+        }
+
+        friend Vector operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_add_ps (Lhs.Native, Rhs.Native); }
+        friend Vector operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_sub_ps (Lhs.Native, Rhs.Native); }
+        friend Vector operator* (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_mul_ps (Lhs.Native, Rhs.Native); }
+        friend Vector operator/ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_div_ps (Lhs.Native, Rhs.Native); }
+
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmp_ps_mask (Lhs.Native, Rhs.Native, _CMP_EQ_OQ);
+        }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmp_ps_mask (Lhs.Native, Rhs.Native, _CMP_NEQ_UQ);
+        }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmp_ps_mask (Lhs.Native, Rhs.Native, _CMP_LT_OQ);
+        }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmp_ps_mask (Lhs.Native, Rhs.Native, _CMP_LE_OQ);
+        }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmp_ps_mask (Lhs.Native, Rhs.Native, _CMP_GT_OQ);
+        }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmp_ps_mask (Lhs.Native, Rhs.Native, _CMP_GE_OQ);
+        }
+
+        friend Vector Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_min_ps (Lhs.Native, Rhs.Native); }
+        friend Vector Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_max_ps (Lhs.Native, Rhs.Native); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+            return _mm512_mask_blend_ps (Selector.Native, WhenFalse.Native, WhenTrue.Native);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      AVX-512 F vector of 16 x 32-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<std::int32_t, 16> {
+    public:
+        typedef std::int32_t           ValueType;
+        typedef std::int32_t           SumType;
+        typedef Mask<std::int32_t, 16> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 16;
+
+        __m512i Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (__m512i Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (std::int32_t Value) Z4GE_NOEXCEPT : Native (_mm512_set1_epi32 (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return _mm512_setzero_si512 (); }
+        static Vector Load (const std::int32_t* Source) Z4GE_NOEXCEPT { return _mm512_loadu_si512 (Source); }
+        static Vector LoadAligned (const std::int32_t* Source) Z4GE_NOEXCEPT { return _mm512_load_si512 (Source); }
+        void          Store (std::int32_t* Destination) const Z4GE_NOEXCEPT { _mm512_storeu_si512 (Destination, Native); }
+        void StoreAligned (std::int32_t* Destination) const Z4GE_NOEXCEPT { _mm512_store_si512 (Destination, Native); }
+
+        std::int32_t operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (64) std::int32_t Values[16];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        template<unsigned I0, unsigned I1, unsigned I2, unsigned I3>
+        Vector Shuffle (void) const Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Shuffle indices must be within [0, 4)");
+            return _mm512_shuffle_epi32 (Native, static_cast<_MM_PERM_ENUM> (_MM_SHUFFLE (I3, I2, I1, I0)));
+        }
+
+        std::int32_t ReduceAdd (void) const Z4GE_NOEXCEPT {
+            const __m256i Half = _mm256_add_epi32 (_mm512_castsi512_si256 (Native), Detail::High256 (Native));
+            return Detail::ReduceAdd128 (_mm_add_epi32 (_mm256_castsi256_si128 (Half), _mm256_extracti128_si256 (Half, 1)));
+        }
+
+        std::int32_t ReduceMin (void) const Z4GE_NOEXCEPT {
+            const __m256i Half = _mm256_min_epi32 (_mm512_castsi512_si256 (Native), Detail::High256 (Native));
+            return Detail::ReduceMin128 (_mm_min_epi32 (_mm256_castsi256_si128 (Half), _mm256_extracti128_si256 (Half, 1)));
+        }
+
+        std::int32_t ReduceMax (void) const Z4GE_NOEXCEPT {
+            const __m256i Half = _mm256_max_epi32 (_mm512_castsi512_si256 (Native), Detail::High256 (Native));
+            return Detail::ReduceMax128 (_mm_max_epi32 (_mm256_castsi256_si128 (Half), _mm256_extracti128_si256 (Half, 1)));
+        }
+
+        friend Vector operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_add_epi32 (Lhs.Native, Rhs.Native); }
+        friend Vector operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_sub_epi32 (Lhs.Native, Rhs.Native); }
+        friend Vector operator* (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_mullo_epi32 (Lhs.Native, Rhs.Native); }
+
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmpeq_epi32_mask (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmpneq_epi32_mask (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmplt_epi32_mask (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmple_epi32_mask (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmpgt_epi32_mask (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmpge_epi32_mask (Lhs.Native, Rhs.Native);
+        }
+
+        friend Vector Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_min_epi32 (Lhs.Native, Rhs.Native); }
+        friend Vector Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_max_epi32 (Lhs.Native, Rhs.Native); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+            return _mm512_mask_blend_epi32 (Selector.Native, WhenFalse.Native, WhenTrue.Native);
+        }
+    };
+#endif
+
+#if Z4GE_SIMD_AVX512BW
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      AVX-512 BW mask for 64 x 8-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Mask<std::int8_t, 64> {
+    public:
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 64;
+
+        __mmask64 Native;
+
+        Mask (void) Z4GE_DEFAULT;
+        Mask (__mmask64 Value) Z4GE_NOEXCEPT : Native (Value) {}
+
+        friend Mask operator& (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return Lhs.Native & Rhs.Native; }
+        friend Mask operator| (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return Lhs.Native | Rhs.Native; }
+        friend Mask operator^ (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return Lhs.Native ^ Rhs.Native; }
+        friend Mask operator~(Mask Operand) Z4GE_NOEXCEPT { return ~Operand.Native; }
+
+        std::uint64_t ToBits (void) const Z4GE_NOEXCEPT { return Native; }
+        bool          Any (void) const Z4GE_NOEXCEPT { return Native != 0; }
+        bool          All (void) const Z4GE_NOEXCEPT { return Native == ~std::uint64_t (0); }
+        bool          None (void) const Z4GE_NOEXCEPT { return Native == 0; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      AVX-512 BW vector of 64 x 8-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<std::int8_t, 64> {
+    public:
+        typedef std::int8_t           ValueType;
+        typedef std::int32_t          SumType;
+        typedef Mask<std::int8_t, 64> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 64;
+
+        __m512i Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (__m512i Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (std::int8_t Value) Z4GE_NOEXCEPT : Native (_mm512_set1_epi8 (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return _mm512_setzero_si512 (); }
+        static Vector Load (const std::int8_t* Source) Z4GE_NOEXCEPT { return _mm512_loadu_si512 (Source); }
+        static Vector LoadAligned (const std::int8_t* Source) Z4GE_NOEXCEPT { return _mm512_load_si512 (Source); }
+        void          Store (std::int8_t* Destination) const Z4GE_NOEXCEPT { _mm512_storeu_si512 (Destination, Native); }
+        void StoreAligned (std::int8_t* Destination) const Z4GE_NOEXCEPT { _mm512_store_si512 (Destination, Native); }
+
+        std::int8_t operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (64) std::int8_t Values[64];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        std::int32_t ReduceAdd (void) const Z4GE_NOEXCEPT {
+            //  Bias the signed lanes into [0, 255] and sum them with the sum of absolute differences against zero
+            const __m512i Sums = _mm512_sad_epu8 (_mm512_xor_si512 (Native, _mm512_set1_epi8 (-128)), _mm512_setzero_si512 ());
+            const __m256i Half = _mm256_add_epi64 (_mm512_castsi512_si256 (Sums), Detail::High256 (Sums));
+            const __m128i Quarter = _mm_add_epi64 (_mm256_castsi256_si128 (Half), _mm256_extracti128_si256 (Half, 1));
+            return _mm_cvtsi128_si32 (Quarter) + _mm_cvtsi128_si32 (_mm_srli_si128 (Quarter, 8)) - 128 * 64;
+        }
+
+        std::int8_t ReduceMin (void) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (64) std::int8_t Values[64];
+            StoreAligned (Values);
+            return Detail::ReduceMinScalar (Values);
+        }
+
+        std::int8_t ReduceMax (void) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (64) std::int8_t Values[64];
+            StoreAligned (Values);
+            return Detail::ReduceMaxScalar (Values);
+        }
+
+        friend Vector operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_add_epi8 (Lhs.Native, Rhs.Native); }
+        friend Vector operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_sub_epi8 (Lhs.Native, Rhs.Native); }
+
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmpeq_epi8_mask (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmpneq_epi8_mask (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmplt_epi8_mask (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmple_epi8_mask (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmpgt_epi8_mask (Lhs.Native, Rhs.Native);
+        }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+            return _mm512_cmpge_epi8_mask (Lhs.Native, Rhs.Native);
+        }
+
+        friend Vector Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_min_epi8 (Lhs.Native, Rhs.Native); }
+        friend Vector Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return _mm512_max_epi8 (Lhs.Native, Rhs.Native); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+            return _mm512_mask_blend_epi8 (Selector.Native, WhenFalse.Native, WhenTrue.Native);
+        }
+    };
+#endif
+
+#if defined(Z4GE_SIMD_AVX512_DIAGNOSTIC_PUSHED)
+#    pragma GCC diagnostic pop
+#    undef Z4GE_SIMD_AVX512_DIAGNOSTIC_PUSHED
+#endif
+
+#if Z4GE_SIMD_NEON
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      NEON mask for 4 lanes, shared by the 32-bit lane vectors
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    namespace Detail {
+
+        class Mask32x4 {
+        public:
+            static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 4;
+
+            uint32x4_t Native;
+
+            Mask32x4 (void) Z4GE_DEFAULT;
+            Mask32x4 (uint32x4_t Value) Z4GE_NOEXCEPT : Native (Value) {}
+
+            friend Mask32x4 operator& (Mask32x4 Lhs, Mask32x4 Rhs) Z4GE_NOEXCEPT { return vandq_u32 (Lhs.Native, Rhs.Native); }
+            friend Mask32x4 operator| (Mask32x4 Lhs, Mask32x4 Rhs) Z4GE_NOEXCEPT { return vorrq_u32 (Lhs.Native, Rhs.Native); }
+            friend Mask32x4 operator^ (Mask32x4 Lhs, Mask32x4 Rhs) Z4GE_NOEXCEPT { return veorq_u32 (Lhs.Native, Rhs.Native); }
+            friend Mask32x4 operator~(Mask32x4 Operand) Z4GE_NOEXCEPT { return vmvnq_u32 (Operand.Native); }
+
+            std::uint64_t ToBits (void) const Z4GE_NOEXCEPT {
+                static const std::uint32_t Weights[4] = {1, 2, 4, 8};
+                const uint32x4_t           Bits       = vandq_u32 (Native, vld1q_u32 (Weights));
+#    if defined(__aarch64__) || defined(_M_ARM64)
+                return vaddvq_u32 (Bits);
+#    else
+                const uint32x2_t Pairs = vadd_u32 (vget_low_u32 (Bits), vget_high_u32 (Bits));
+                return vget_lane_u32 (vpadd_u32 (Pairs, Pairs), 0);
+#    endif
+            }
+
+            bool Any (void) const Z4GE_NOEXCEPT { return ToBits () != 0; }
+            bool All (void) const Z4GE_NOEXCEPT { return ToBits () == 0xFu; }
+            bool None (void) const Z4GE_NOEXCEPT { return ToBits () == 0; }
+        };
+
+    } // namespace Detail
+
+    template<>
+    class Mask<float, 4> : public Detail::Mask32x4 {
+    public:
+        Mask (void) Z4GE_DEFAULT;
+        Mask (Detail::Mask32x4 Value) Z4GE_NOEXCEPT : Detail::Mask32x4 (Value) {}
+        Mask (uint32x4_t Value) Z4GE_NOEXCEPT : Detail::Mask32x4 (Value) {}
+    };
+
+    template<>
+    class Mask<std::int32_t, 4> : public Detail::Mask32x4 {
+    public:
+        Mask (void) Z4GE_DEFAULT;
+        Mask (Detail::Mask32x4 Value) Z4GE_NOEXCEPT : Detail::Mask32x4 (Value) {}
+        Mask (uint32x4_t Value) Z4GE_NOEXCEPT : Detail::Mask32x4 (Value) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      NEON vector of 4 x 32-bit floating point lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<float, 4> {
+    public:
+        typedef float          ValueType;
+        typedef float          SumType;
+        typedef Mask<float, 4> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 4;
+
+        float32x4_t Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (float32x4_t Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (float Value) Z4GE_NOEXCEPT : Native (vdupq_n_f32 (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return vdupq_n_f32 (0.0f); }
+        static Vector Load (const float* Source) Z4GE_NOEXCEPT { return vld1q_f32 (Source); }
+        static Vector LoadAligned (const float* Source) Z4GE_NOEXCEPT { return vld1q_f32 (Source); }
+        void          Store (float* Destination) const Z4GE_NOEXCEPT { vst1q_f32 (Destination, Native); }
+        void          StoreAligned (float* Destination) const Z4GE_NOEXCEPT { vst1q_f32 (Destination, Native); }
+
+        float operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (16) float Values[4];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        template<unsigned I0, unsigned I1, unsigned I2, unsigned I3>
+        Vector Shuffle (void) const Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Shuffle indices must be within [0, 4)");
+            float32x4_t Result = vdupq_n_f32 (vgetq_lane_f32 (Native, I0));
+            Result             = vsetq_lane_f32 (vgetq_lane_f32 (Native, I1), Result, 1);
+            Result             = vsetq_lane_f32 (vgetq_lane_f32 (Native, I2), Result, 2);
+            return vsetq_lane_f32 (vgetq_lane_f32 (Native, I3), Result, 3);
+        }
+
+        float ReduceAdd (void) const Z4GE_NOEXCEPT {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            return vaddvq_f32 (Native);
+#    else
+            const float32x2_t Pairs = vadd_f32 (vget_low_f32 (Native), vget_high_f32 (Native));
+            return vget_lane_f32 (vpadd_f32 (Pairs, Pairs), 0);
+#    endif
+        }
+
+        float ReduceMin (void) const Z4GE_NOEXCEPT {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            return vminvq_f32 (Native);
+#    else
+            const float32x2_t Pairs = vmin_f32 (vget_low_f32 (Native), vget_high_f32 (Native));
+            return vget_lane_f32 (vpmin_f32 (Pairs, Pairs), 0);
+#    endif
+        }
+
+        float ReduceMax (void) const Z4GE_NOEXCEPT {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            return vmaxvq_f32 (Native);
+#    else
+            const float32x2_t Pairs = vmax_f32 (vget_low_f32 (Native), vget_high_f32 (Native));
+            return vget_lane_f32 (vpmax_f32 (Pairs, Pairs), 0);
+#    endif
+        }
+
+        friend Vector operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vaddq_f32 (Lhs.Native, Rhs.Native); }
+        friend Vector operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vsubq_f32 (Lhs.Native, Rhs.Native); }
+        friend Vector operator* (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vmulq_f32 (Lhs.Native, Rhs.Native); }
+
+        friend Vector operator/ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            return vdivq_f32 (Lhs.Native, Rhs.Native);
+#    else
+            //  ARMv7 NEON has no division; refine the reciprocal estimate twice with Newton-Raphson steps
+            float32x4_t Reciprocal = vrecpeq_f32 (Rhs.Native);
+            Reciprocal             = vmulq_f32 (vrecpsq_f32 (Rhs.Native, Reciprocal), Reciprocal);
+            Reciprocal             = vmulq_f32 (vrecpsq_f32 (Rhs.Native, Reciprocal), Reciprocal);
+            return vmulq_f32 (Lhs.Native, Reciprocal);
+#    endif
+        }
+
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vceqq_f32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs == Rhs); }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcltq_f32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcleq_f32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcgtq_f32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcgeq_f32 (Lhs.Native, Rhs.Native); }
+        friend Vector   Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vminq_f32 (Lhs.Native, Rhs.Native); }
+        friend Vector   Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vmaxq_f32 (Lhs.Native, Rhs.Native); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+            return vbslq_f32 (Selector.Native, WhenTrue.Native, WhenFalse.Native);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      NEON vector of 4 x 32-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<std::int32_t, 4> {
+    public:
+        typedef std::int32_t          ValueType;
+        typedef std::int32_t          SumType;
+        typedef Mask<std::int32_t, 4> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 4;
+
+        int32x4_t Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (int32x4_t Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (std::int32_t Value) Z4GE_NOEXCEPT : Native (vdupq_n_s32 (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return vdupq_n_s32 (0); }
+        static Vector Load (const std::int32_t* Source) Z4GE_NOEXCEPT { return vld1q_s32 (Source); }
+        static Vector LoadAligned (const std::int32_t* Source) Z4GE_NOEXCEPT { return vld1q_s32 (Source); }
+        void          Store (std::int32_t* Destination) const Z4GE_NOEXCEPT { vst1q_s32 (Destination, Native); }
+        void          StoreAligned (std::int32_t* Destination) const Z4GE_NOEXCEPT { vst1q_s32 (Destination, Native); }
+
+        std::int32_t operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (16) std::int32_t Values[4];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        template<unsigned I0, unsigned I1, unsigned I2, unsigned I3>
+        Vector Shuffle (void) const Z4GE_NOEXCEPT {
+            Z4GE_STATIC_ASSERT (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4, "Shuffle indices must be within [0, 4)");
+            int32x4_t Result = vdupq_n_s32 (vgetq_lane_s32 (Native, I0));
+            Result           = vsetq_lane_s32 (vgetq_lane_s32 (Native, I1), Result, 1);
+            Result           = vsetq_lane_s32 (vgetq_lane_s32 (Native, I2), Result, 2);
+            return vsetq_lane_s32 (vgetq_lane_s32 (Native, I3), Result, 3);
+        }
+
+        std::int32_t ReduceAdd (void) const Z4GE_NOEXCEPT {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            return vaddvq_s32 (Native);
+#    else
+            const int32x2_t Pairs = vadd_s32 (vget_low_s32 (Native), vget_high_s32 (Native));
+            return vget_lane_s32 (vpadd_s32 (Pairs, Pairs), 0);
+#    endif
+        }
+
+        std::int32_t ReduceMin (void) const Z4GE_NOEXCEPT {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            return vminvq_s32 (Native);
+#    else
+            const int32x2_t Pairs = vmin_s32 (vget_low_s32 (Native), vget_high_s32 (Native));
+            return vget_lane_s32 (vpmin_s32 (Pairs, Pairs), 0);
+#    endif
+        }
+
+        std::int32_t ReduceMax (void) const Z4GE_NOEXCEPT {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            return vmaxvq_s32 (Native);
+#    else
+            const int32x2_t Pairs = vmax_s32 (vget_low_s32 (Native), vget_high_s32 (Native));
+            return vget_lane_s32 (vpmax_s32 (Pairs, Pairs), 0);
+#    endif
+        }
+
+        friend Vector   operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vaddq_s32 (Lhs.Native, Rhs.Native); }
+        friend Vector   operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vsubq_s32 (Lhs.Native, Rhs.Native); }
+        friend Vector   operator* (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vmulq_s32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vceqq_s32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs == Rhs); }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcltq_s32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcleq_s32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcgtq_s32 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcgeq_s32 (Lhs.Native, Rhs.Native); }
+        friend Vector   Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vminq_s32 (Lhs.Native, Rhs.Native); }
+        friend Vector   Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vmaxq_s32 (Lhs.Native, Rhs.Native); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+            return vbslq_s32 (Selector.Native, WhenTrue.Native, WhenFalse.Native);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      NEON mask for 16 x 8-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Mask<std::int8_t, 16> {
+    public:
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 16;
+
+        uint8x16_t Native;
+
+        Mask (void) Z4GE_DEFAULT;
+        Mask (uint8x16_t Value) Z4GE_NOEXCEPT : Native (Value) {}
+
+        friend Mask operator& (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return vandq_u8 (Lhs.Native, Rhs.Native); }
+        friend Mask operator| (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return vorrq_u8 (Lhs.Native, Rhs.Native); }
+        friend Mask operator^ (Mask Lhs, Mask Rhs) Z4GE_NOEXCEPT { return veorq_u8 (Lhs.Native, Rhs.Native); }
+        friend Mask operator~(Mask Operand) Z4GE_NOEXCEPT { return vmvnq_u8 (Operand.Native); }
+
+        std::uint64_t ToBits (void) const Z4GE_NOEXCEPT {
+            //  Weight each lane by its bit position within its half, then sum the halves separately
+            static const std::uint8_t Weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+            const uint8x16_t          Bits        = vandq_u8 (Native, vld1q_u8 (Weights));
+            const uint64x2_t          Sums        = vpaddlq_u32 (vpaddlq_u16 (vpaddlq_u8 (Bits)));
+            return vgetq_lane_u64 (Sums, 0) | (vgetq_lane_u64 (Sums, 1) << 8);
+        }
+
+        bool Any (void) const Z4GE_NOEXCEPT { return ToBits () != 0; }
+        bool All (void) const Z4GE_NOEXCEPT { return ToBits () == 0xFFFFu; }
+        bool None (void) const Z4GE_NOEXCEPT { return ToBits () == 0; }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      NEON vector of 16 x 8-bit signed integer lanes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template<>
+    class Vector<std::int8_t, 16> {
+    public:
+        typedef std::int8_t           ValueType;
+        typedef std::int32_t          SumType;
+        typedef Mask<std::int8_t, 16> MaskType;
+
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t Lanes = 16;
+
+        int8x16_t Native;
+
+        Vector (void) Z4GE_DEFAULT;
+        Vector (int8x16_t Value) Z4GE_NOEXCEPT : Native (Value) {}
+        explicit Vector (std::int8_t Value) Z4GE_NOEXCEPT : Native (vdupq_n_s8 (Value)) {}
+
+        static Vector Zero (void) Z4GE_NOEXCEPT { return vdupq_n_s8 (0); }
+        static Vector Load (const std::int8_t* Source) Z4GE_NOEXCEPT { return vld1q_s8 (Source); }
+        static Vector LoadAligned (const std::int8_t* Source) Z4GE_NOEXCEPT { return vld1q_s8 (Source); }
+        void          Store (std::int8_t* Destination) const Z4GE_NOEXCEPT { vst1q_s8 (Destination, Native); }
+        void          StoreAligned (std::int8_t* Destination) const Z4GE_NOEXCEPT { vst1q_s8 (Destination, Native); }
+
+        std::int8_t operator[] (std::size_t Index) const Z4GE_NOEXCEPT {
+            Z4GE_ALIGN_AS (16) std::int8_t Values[16];
+            StoreAligned (Values);
+            return Values[Index];
+        }
+
+        std::int32_t ReduceAdd (void) const Z4GE_NOEXCEPT {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            return vaddlvq_s8 (Native);
+#    else
+            const int64x2_t Sums = vpaddlq_s32 (vpaddlq_s16 (vpaddlq_s8 (Native)));
+            return static_cast<std::int32_t> (vgetq_lane_s64 (Sums, 0) + vgetq_lane_s64 (Sums, 1));
+#    endif
+        }
+
+        std::int8_t ReduceMin (void) const Z4GE_NOEXCEPT {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            return vminvq_s8 (Native);
+#    else
+            Z4GE_ALIGN_AS (16) std::int8_t Values[16];
+            StoreAligned (Values);
+            return Detail::ReduceMinScalar (Values);
+#    endif
+        }
+
+        std::int8_t ReduceMax (void) const Z4GE_NOEXCEPT {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+            return vmaxvq_s8 (Native);
+#    else
+            Z4GE_ALIGN_AS (16) std::int8_t Values[16];
+            StoreAligned (Values);
+            return Detail::ReduceMaxScalar (Values);
+#    endif
+        }
+
+        friend Vector   operator+ (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vaddq_s8 (Lhs.Native, Rhs.Native); }
+        friend Vector   operator- (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vsubq_s8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator== (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vceqq_s8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator!= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return ~(Lhs == Rhs); }
+        friend MaskType operator< (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcltq_s8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator<= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcleq_s8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator> (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcgtq_s8 (Lhs.Native, Rhs.Native); }
+        friend MaskType operator>= (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vcgeq_s8 (Lhs.Native, Rhs.Native); }
+        friend Vector   Min (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vminq_s8 (Lhs.Native, Rhs.Native); }
+        friend Vector   Max (Vector Lhs, Vector Rhs) Z4GE_NOEXCEPT { return vmaxq_s8 (Lhs.Native, Rhs.Native); }
+
+        friend Vector Select (MaskType Selector, Vector WhenTrue, Vector WhenFalse) Z4GE_NOEXCEPT {
+            return vbslq_s8 (Selector.Native, WhenTrue.Native, WhenFalse.Native);
+        }
+    };
+#endif
+
+}} // namespace Z4GE::Simd
+
+/// @}
+
+#endif
@@ -0,0 +1,401 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef Z4GE_CONFIGURATION__TOPOLOGY_HH_
+#define Z4GE_CONFIGURATION__TOPOLOGY_HH_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file       Z4GE/Configuration/Topology.hh
+/// @brief      Runtime Hardware Topology Identification
+/// @details    This header queries the processor topology of the executing machine, i.e. the number of logical CPUs and
+///             physical cores, the SMT sibling groups, the NUMA nodes and the cache hierarchy, so that thread pools and
+///             blocking factors can be sized at startup rather than tuned by hand.
+///
+///             The topology is read from sysfs (`/sys/devices/system/cpu` and `/sys/devices/system/node`) on Linux and
+///             Android. When sysfs does not describe the caches, they are read from CPUID leaf 4 (Intel) or leaf
+///             0x8000001D (AMD) on x86. On other platforms, every logical CPU reported by `std::thread` is considered a
+///             physical core of a single NUMA node.
+///
+///             The topology is detected once, on the first call to
+///             @ref Z4GE::Configuration::GetTopology "GetTopology", and the immutable snapshot is returned afterwards.
+///             CPU hotplug after the first call is therefore not reflected.
+/// @note       Unlike the other Z4GE.Configuration headers, this header is not included by @ref Z4GE/Configuration.hh since
+///             it depends on the standard library containers and file streams.
+/// @addtogroup z4ge_configuration
+/// @{
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Macros.hh>
+#include <Z4GE/Configuration/Platform.hh>
+#include <Z4GE/Configuration/RuntimeArchitecture.hh>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if Z4GE_PLATFORM & (Z4GE_PLATFORM_LINUX | Z4GE_PLATFORM_ANDROID)
+#    define Z4GE_TOPOLOGY_SYSFS Z4GE_ENABLE
+#else
+#    define Z4GE_TOPOLOGY_SYSFS Z4GE_DISABLE
+#endif
+
+namespace Z4GE { namespace Configuration {
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Cache Type
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum CacheType {
+        DataCache        = 1, ///!    Data cache
+        InstructionCache = 2, ///!    Instruction cache
+        UnifiedCache     = 3  ///!    Unified (data and instruction) cache
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Description of a single cache as seen by a logical CPU
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct CacheInfo {
+        unsigned    Level;         ///!    Cache level, starting from 1
+        CacheType   Type;          ///!    Cache type
+        std::size_t Size;          ///!    Total size, in bytes
+        std::size_t LineSize;      ///!    Coherency line size, in bytes
+        unsigned    Associativity; ///!    Number of ways, 0 if unknown
+        unsigned    SharingCount;  ///!    Number of logical CPUs sharing this cache (an upper bound when read from CPUID)
+
+        /// @brief  Logical CPUs sharing this cache. Empty when the sharing set is unknown (CPUID only reports a count)
+        std::vector<unsigned> SharedCpus;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Hardware Topology Snapshot
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct Topology {
+        unsigned LogicalCpus;   ///!    Number of online logical CPUs (hardware threads)
+        unsigned PhysicalCores; ///!    Number of physical cores, i.e. SMT sibling groups
+        unsigned Packages;      ///!    Number of physical packages (sockets)
+        unsigned NumaNodes;     ///!    Number of NUMA nodes
+
+        /// @brief  Logical CPUs of each physical core. Each group contains a single CPU if SMT is disabled or unavailable
+        std::vector<std::vector<unsigned>> SmtSiblings;
+        /// @brief  Logical CPUs of each NUMA node
+        std::vector<std::vector<unsigned>> NumaNodeCpus;
+        /// @brief  The caches of the first online logical CPU, ordered by level
+        std::vector<CacheInfo> Caches;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Finds the cache of the given @p Level that holds data, i.e. a data or a unified cache
+        /// @returns    The cache, `nullptr` if there is no such cache
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const CacheInfo* FindDataCache (unsigned Level) const Z4GE_NOEXCEPT {
+            for (std::size_t Index = 0; Index < Caches.size (); ++Index) {
+                if (Caches[Index].Level == Level && Caches[Index].Type != InstructionCache) {
+                    return &Caches[Index];
+                }
+            }
+            return nullptr;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Size of the data cache of the given @p Level, in bytes
+        /// @returns    The size, 0 if there is no such cache
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t DataCacheSize (unsigned Level) const Z4GE_NOEXCEPT {
+            const CacheInfo* Cache = FindDataCache (Level);
+            return Cache ? Cache->Size : 0;
+        }
+    };
+
+    namespace Detail {
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Parses a CPU list as formatted by the kernel (eg. `0-3,8,10-11`)
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline std::vector<unsigned> ParseCpuList (const std::string& List) {
+            std::vector<unsigned> Cpus;
+            const char*           Cursor = List.c_str ();
+            while (*Cursor) {
+                char*               End   = nullptr;
+                const unsigned long First = std::strtoul (Cursor, &End, 10);
+                if (End == Cursor) {
+                    break;
+                }
+                unsigned long Last = First;
+                Cursor             = End;
+                if (*Cursor == '-') {
+                    Last   = std::strtoul (Cursor + 1, &End, 10);
+                    Cursor = End;
+                }
+                for (unsigned long Cpu = First; Cpu <= Last; ++Cpu) Cpus.push_back (static_cast<unsigned> (Cpu));
+                if (*Cursor == ',') {
+                    ++Cursor;
+                }
+            }
+            return Cpus;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Parses a cache size as formatted by the kernel (eg. `48K`, `2048K`, `32M`)
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline std::size_t ParseCacheSize (const std::string& Text) {
+            char*               End  = nullptr;
+            const unsigned long Size = std::strtoul (Text.c_str (), &End, 10);
+            switch (*End) {
+            case 'K': return static_cast<std::size_t> (Size) << 10;
+            case 'M': return static_cast<std::size_t> (Size) << 20;
+            case 'G': return static_cast<std::size_t> (Size) << 30;
+            default: return static_cast<std::size_t> (Size);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Reads the first line of a (sysfs) file
+        /// @returns    `false` if the file could not be read
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool ReadFirstLine (const std::string& Path, std::string& Line) {
+            std::ifstream File (Path.c_str ());
+            return static_cast<bool> (std::getline (File, Line));
+        }
+
+        inline unsigned ReadUnsigned (const std::string& Path, unsigned Default) {
+            std::string Line;
+            if (!ReadFirstLine (Path, Line)) {
+                return Default;
+            }
+            return static_cast<unsigned> (std::strtoul (Line.c_str (), nullptr, 10));
+        }
+
+        inline std::string ToString (unsigned Value) {
+            std::string Text;
+            do {
+                Text.insert (Text.begin (), static_cast<char> ('0' + Value % 10));
+                Value /= 10;
+            } while (Value);
+            return Text;
+        }
+
+        inline bool CompareCaches (const CacheInfo& Lhs, const CacheInfo& Rhs) {
+            return Lhs.Level != Rhs.Level ? Lhs.Level < Rhs.Level : Lhs.Type < Rhs.Type;
+        }
+
+#if Z4GE_RUNTIME_ARCHITECTURE_X86
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Reads the deterministic cache parameters from CPUID leaf 4 (Intel) or leaf 0x8000001D (AMD)
+        /// @details    Both leaves share the same layout. Each sub-leaf describes one cache, until a sub-leaf of type 0.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline std::vector<CacheInfo> DetectCachesCpuid (void) {
+            std::vector<CacheInfo> Caches;
+            std::uint32_t          Registers[4];
+
+            QueryCpuid (0, 0, Registers);
+            const std::uint32_t MaximumLeaf = Registers[0];
+            //  "AuthenticAMD" and "HygonGenuine" (EBX, EDX, ECX)
+            const bool Amd = (Registers[1] == 0x68747541u && Registers[3] == 0x69746E65u && Registers[2] == 0x444D4163u) ||
+                             (Registers[1] == 0x6F677948u && Registers[3] == 0x6E65476Eu && Registers[2] == 0x656E6975u);
+
+            std::uint32_t Leaf = 0;
+            if (Amd) {
+                QueryCpuid (0x80000000u, 0, Registers);
+                const std::uint32_t MaximumExtendedLeaf = Registers[0];
+                QueryCpuid (0x80000001u, 0, Registers);
+                //  TopologyExtensions (ECX bit 22) indicates the availability of leaf 0x8000001D
+                if (MaximumExtendedLeaf >= 0x8000001Du && (Registers[2] & (1u << 22))) {
+                    Leaf = 0x8000001Du;
+                }
+            } else if (MaximumLeaf >= 4) {
+                Leaf = 4;
+            }
+            if (!Leaf) {
+                return Caches;
+            }
+
+            for (std::uint32_t SubLeaf = 0; SubLeaf < 32; ++SubLeaf) {
+                QueryCpuid (Leaf, SubLeaf, Registers);
+                const std::uint32_t Type = Registers[0] & 0x1Fu;
+                if (Type == 0 || Type > 3) {
+                    break;
+                }
+
+                const std::size_t Ways       = ((Registers[1] >> 22) & 0x3FFu) + 1;
+                const std::size_t Partitions = ((Registers[1] >> 12) & 0x3FFu) + 1;
+                const std::size_t LineSize   = (Registers[1] & 0xFFFu) + 1;
+                const std::size_t Sets       = static_cast<std::size_t> (Registers[2]) + 1;
+
+                CacheInfo Cache;
+                Cache.Level         = (Registers[0] >> 5) & 0x7u;
+                Cache.Type          = static_cast<CacheType> (Type);
+                Cache.Size          = Ways * Partitions * LineSize * Sets;
+                Cache.LineSize      = LineSize;
+                Cache.Associativity = static_cast<unsigned> (Ways);
+                Cache.SharingCount  = ((Registers[0] >> 14) & 0xFFFu) + 1;
+                Caches.push_back (Cache);
+            }
+            std::sort (Caches.begin (), Caches.end (), CompareCaches);
+            return Caches;
+        }
+#endif
+
+#if Z4GE_TOPOLOGY_SYSFS
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Reads the caches of the given logical @p Cpu from `/sys/devices/system/cpu/cpuN/cache/indexK`
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline std::vector<CacheInfo> DetectCachesSysfs (unsigned Cpu) {
+            std::vector<CacheInfo> Caches;
+            const std::string      CacheDirectory = "/sys/devices/system/cpu/cpu" + ToString (Cpu) + "/cache/index";
+
+            for (unsigned Index = 0;; ++Index) {
+                const std::string Directory = CacheDirectory + ToString (Index) + "/";
+                std::string       Type, Size;
+                if (!ReadFirstLine (Directory + "type", Type) || !ReadFirstLine (Directory + "size", Size)) {
+                    break;
+                }
+
+                CacheInfo Cache;
+                Cache.Level         = ReadUnsigned (Directory + "level", 0);
+                Cache.Type          = Type == "Data" ? DataCache : Type == "Instruction" ? InstructionCache : UnifiedCache;
+                Cache.Size          = ParseCacheSize (Size);
+                Cache.LineSize      = ReadUnsigned (Directory + "coherency_line_size", 0);
+                Cache.Associativity = ReadUnsigned (Directory + "ways_of_associativity", 0);
+
+                std::string SharedCpus;
+                if (ReadFirstLine (Directory + "shared_cpu_list", SharedCpus)) {
+                    Cache.SharedCpus = ParseCpuList (SharedCpus);
+                }
+                Cache.SharingCount = Cache.SharedCpus.empty () ? 1u : static_cast<unsigned> (Cache.SharedCpus.size ());
+                Caches.push_back (Cache);
+            }
+            std::sort (Caches.begin (), Caches.end (), CompareCaches);
+            return Caches;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Reads the CPU, core, package and NUMA node topology from sysfs
+        /// @returns    `false` if sysfs is not available
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline bool DetectTopologySysfs (Topology& Result) {
+            std::string Online;
+            if (!ReadFirstLine ("/sys/devices/system/cpu/online", Online)) {
+                return false;
+            }
+            const std::vector<unsigned> Cpus = ParseCpuList (Online);
+            if (Cpus.empty ()) {
+                return false;
+            }
+
+            std::vector<unsigned> PackageIds;
+            for (std::size_t Index = 0; Index < Cpus.size (); ++Index) {
+                const std::string Directory = "/sys/devices/system/cpu/cpu" + ToString (Cpus[Index]) + "/topology/";
+
+                std::string           Siblings;
+                std::vector<unsigned> Core;
+                if (ReadFirstLine (Directory + "core_cpus_list", Siblings) ||
+                    ReadFirstLine (Directory + "thread_siblings_list", Siblings)) {
+                    Core = ParseCpuList (Siblings);
+                }
+                if (Core.empty ()) {
+                    Core.push_back (Cpus[Index]);
+                }
+                if (std::find (Result.SmtSiblings.begin (), Result.SmtSiblings.end (), Core) == Result.SmtSiblings.end ()) {
+                    Result.SmtSiblings.push_back (Core);
+                }
+
+                const unsigned PackageId = ReadUnsigned (Directory + "physical_package_id", 0);
+                if (std::find (PackageIds.begin (), PackageIds.end (), PackageId) == PackageIds.end ()) {
+                    PackageIds.push_back (PackageId);
+                }
+            }
+
+            std::string Nodes;
+            if (ReadFirstLine ("/sys/devices/system/node/online", Nodes)) {
+                const std::vector<unsigned> NodeIds = ParseCpuList (Nodes);
+                for (std::size_t Index = 0; Index < NodeIds.size (); ++Index) {
+                    std::string NodeCpus;
+                    ReadFirstLine ("/sys/devices/system/node/node" + ToString (NodeIds[Index]) + "/cpulist", NodeCpus);
+                    Result.NumaNodeCpus.push_back (ParseCpuList (NodeCpus));
+                }
+            }
+            if (Result.NumaNodeCpus.empty ()) {
+                Result.NumaNodeCpus.push_back (Cpus);
+            }
+
+            Result.LogicalCpus   = static_cast<unsigned> (Cpus.size ());
+            Result.PhysicalCores = static_cast<unsigned> (Result.SmtSiblings.size ());
+            Result.Packages      = static_cast<unsigned> (PackageIds.size ());
+            Result.NumaNodes     = static_cast<unsigned> (Result.NumaNodeCpus.size ());
+            Result.Caches        = DetectCachesSysfs (Cpus.front ());
+            return true;
+        }
+#endif
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief      Queries the hardware topology of the executing machine
+        /// @details    This function performs the actual (uncached) detection. Prefer
+        ///             @ref Z4GE::Configuration::GetTopology "GetTopology", which caches the result.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        inline Topology DetectTopology (void) {
+            Topology Result;
+            Result.LogicalCpus = Result.PhysicalCores = Result.Packages = Result.NumaNodes = 0;
+
+#if Z4GE_TOPOLOGY_SYSFS
+            if (!DetectTopologySysfs (Result))
+#endif
+            {
+                const unsigned Concurrency = std::thread::hardware_concurrency ();
+                Result.LogicalCpus         = Concurrency ? Concurrency : 1u;
+                Result.PhysicalCores       = Result.LogicalCpus;
+                Result.Packages            = 1;
+                Result.NumaNodes           = 1;
+                Result.NumaNodeCpus.resize (1);
+                for (unsigned Cpu = 0; Cpu < Result.LogicalCpus; ++Cpu) {
+                    Result.SmtSiblings.push_back (std::vector<unsigned> (1, Cpu));
+                    Result.NumaNodeCpus[0].push_back (Cpu);
+                }
+            }
+
+#if Z4GE_RUNTIME_ARCHITECTURE_X86
+            if (Result.Caches.empty ()) {
+                Result.Caches = DetectCachesCpuid ();
+            }
+#endif
+            return Result;
+        }
+
+    } // namespace Detail
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief      Get the hardware topology of the executing machine
+    /// @details    The topology is detected on the first call and an immutable snapshot is returned by every call. The
+    ///             initialization is thread-safe.
+    /// @returns    The topology snapshot
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline const Topology& GetTopology (void) {
+        static const Topology Snapshot = Detail::DetectTopology ();
+        return Snapshot;
+    }
+
+}} // namespace Z4GE::Configuration
+
+/// @}
+
+#endif
@@ -0,0 +1,103 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/AlignedAlloc.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+    bool IsAligned (const void* Pointer, std::size_t Alignment) {
+        return reinterpret_cast<std::uintptr_t> (Pointer) % Alignment == 0;
+    }
+
+    struct Z4GE_ALIGN_AS (64) Overaligned {
+        int Value;
+    };
+
+} // namespace
+
+TEST_CASE ("Aligned allocation", "[AlignedAlloc]") {
+    const std::size_t Alignments[] = { 1, 2, 8, 16, 32, 64, 128, 4096 };
+    for (std::size_t Index = 0; Index < sizeof (Alignments) / sizeof (Alignments[0]); ++Index) {
+        void* Pointer = Z4GE::AlignedAlloc (100, Alignments[Index]);
+        REQUIRE (Pointer != nullptr);
+        REQUIRE (IsAligned (Pointer, Alignments[Index]));
+        std::memset (Pointer, 0xA5, 100);
+        Z4GE::AlignedFree (Pointer, Alignments[Index]);
+    }
+
+    void* Empty = Z4GE::AlignedAlloc (0, 64);
+    REQUIRE (Empty != nullptr);
+    Z4GE::AlignedFree (Empty, 64);
+    Z4GE::AlignedFree (nullptr, 64);
+}
+
+TEST_CASE ("Aligned allocation rejects invalid alignments", "[AlignedAlloc]") {
+    REQUIRE (Z4GE::AlignedAlloc (16, 0) == nullptr);
+    REQUIRE (Z4GE::AlignedAlloc (16, 24) == nullptr);
+}
+
+TEST_CASE ("Aligned allocator", "[AlignedAlloc]") {
+    std::vector<float, Z4GE::AlignedAllocator<float, 64>> Samples;
+    for (int Index = 0; Index < 1000; ++Index) {
+        Samples.push_back (static_cast<float> (Index));
+        REQUIRE (IsAligned (Samples.data (), 64));
+    }
+    REQUIRE (Samples[999] == 999.0f);
+
+    //  Node based containers rebind the allocator to their node type
+    std::list<int, Z4GE::AlignedAllocator<int, 32>> Values (3, 7);
+    REQUIRE (Values.size () == 3);
+
+    REQUIRE (Z4GE::AlignedAllocator<int, 32> () == Z4GE::AlignedAllocator<float, 32> ());
+    REQUIRE (Z4GE::AlignedAllocator<int, 32> () != Z4GE::AlignedAllocator<int, 64> ());
+}
+
+TEST_CASE ("Aligned allocator rebinding", "[AlignedAlloc]") {
+    typedef Z4GE::AlignedAllocator<float, 16>                            Allocator;
+    typedef std::allocator_traits<Allocator>::rebind_alloc<Overaligned> Rebound;
+
+    //  The rebound allocator keeps the alignment, so that rebinding it back yields the original allocator
+    STATIC_REQUIRE ((std::is_same<std::allocator_traits<Rebound>::rebind_alloc<float>, Allocator>::value));
+
+    //  A type stricter than the alignment of the allocator is allocated with its own alignment
+    Rebound      Nodes;
+    Overaligned* Node = Nodes.allocate (3);
+    REQUIRE (IsAligned (Node, 64));
+    Nodes.deallocate (Node, 3);
+
+    std::vector<Overaligned, Rebound> Values (5);
+    REQUIRE (IsAligned (Values.data (), 64));
+    REQUIRE (Rebound (Allocator ()) == Allocator ());
+
+    //  Only the allocators that compare equal convert into each other
+    STATIC_REQUIRE ((std::is_convertible<Allocator, Z4GE::AlignedAllocator<int, 16>>::value));
+    STATIC_REQUIRE_FALSE ((std::is_convertible<Allocator, Z4GE::AlignedAllocator<int, 32>>::value));
+}
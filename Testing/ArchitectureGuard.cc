@@ -0,0 +1,47 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/ArchitectureGuard.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+TEST_CASE ("Architecture Guard Feature Names", "[architecture]") {
+    REQUIRE (std::string (Z4GE::Configuration::GetArchitectureFeatureName (Z4GE_ARCHITECTURE_BIT_AVX2)) == "AVX2");
+    REQUIRE (std::string (Z4GE::Configuration::GetArchitectureFeatureName (Z4GE_ARCHITECTURE_BIT_SSE41)) == "SSE4.1");
+    REQUIRE (Z4GE::Configuration::GetArchitectureFeatureName (Z4GE_ARCHITECTURE_AVX2) == nullptr);
+    for (Z4GE::Configuration::ArchitectureMask Bit = 1; Bit <= Z4GE_ARCHITECTURE_BIT_AVX512VNNI; Bit <<= 1) {
+        //  0x0008 is not assigned
+        REQUIRE ((Z4GE::Configuration::GetArchitectureFeatureName (Bit) != nullptr) == (Bit != 0x0008u));
+    }
+}
+
+TEST_CASE ("Architecture Guard Missing Features", "[architecture]") {
+    //  The guard of this translation unit has already passed, otherwise the test would have aborted
+    REQUIRE (Z4GE_CONFIGURATION_ARCHITECTURE_GUARD);
+    REQUIRE (Z4GE::Configuration::GetMissingArchitecture (Z4GE_ARCHITECTURE_GUARD_REQUIRED) == 0u);
+
+    const Z4GE::Configuration::ArchitectureMask Runtime = Z4GE::Configuration::GetRuntimeArchitecture ();
+    REQUIRE (Z4GE::Configuration::GetMissingArchitecture (Runtime) == 0u);
+    REQUIRE (Z4GE::Configuration::GetMissingArchitecture (~Runtime) == ~Runtime);
+}
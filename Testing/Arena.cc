@@ -0,0 +1,120 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/Arena.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+    bool IsAligned (const void* Pointer, std::size_t Alignment) {
+        return reinterpret_cast<std::uintptr_t> (Pointer) % Alignment == 0;
+    }
+
+    struct Z4GE_ALIGN_AS (32) Block {
+        float Values[8];
+    };
+
+    struct Point {
+        Point (int Horizontal, int Vertical) : X (Horizontal), Y (Vertical) {}
+        int X, Y;
+    };
+
+} // namespace
+
+TEST_CASE ("Arena allocation and alignment", "[Arena]") {
+    Z4GE::Arena Arena (256);
+    REQUIRE (Arena.Capacity () == 0);
+
+    char* Bytes = static_cast<char*> (Arena.Allocate (3, 1));
+    REQUIRE (Bytes != nullptr);
+    Block* Blocks = Arena.Allocate<Block> (2);
+    REQUIRE (IsAligned (Blocks, 32));
+    REQUIRE (reinterpret_cast<char*> (Blocks) >= Bytes + 3);
+    double* Wide = Arena.Allocate<double> ();
+    REQUIRE (IsAligned (Wide, Z4GE_ALIGN_OF (double)));
+    void* Page = Arena.Allocate (16, 4096);
+    REQUIRE (IsAligned (Page, 4096));
+
+    Point* Created = Arena.Create<Point> (3, 4);
+    REQUIRE (Created->X == 3);
+    REQUIRE (Created->Y == 4);
+}
+
+TEST_CASE ("Arena chunked growth and reset", "[Arena]") {
+    Z4GE::Arena Arena (128);
+    void*       First = Arena.Allocate (100);
+    void*       Second = Arena.Allocate (100);
+    REQUIRE (First != Second);
+    REQUIRE (Arena.Capacity () >= 200);
+
+    //  Allocations larger than the chunk size get a dedicated chunk
+    char* Large = static_cast<char*> (Arena.Allocate (1000));
+    std::memset (Large, 0, 1000);
+
+    const std::size_t Capacity = Arena.Capacity ();
+    Arena.Reset ();
+    REQUIRE (Arena.Allocate (100) == First);
+    REQUIRE (Arena.Allocate (100) == Second);
+    REQUIRE (Arena.Capacity () == Capacity);
+
+    Arena.Release ();
+    REQUIRE (Arena.Capacity () == 0);
+    REQUIRE (Arena.Allocate (8) != nullptr);
+}
+
+TEST_CASE ("Arena frames", "[Arena]") {
+    Z4GE::Arena Arena (128);
+    int*        Persistent = Arena.Allocate<int> ();
+    void*       Reused     = nullptr;
+    {
+        Z4GE::Arena::Frame Frame (Arena);
+        Reused = Arena.Allocate (64);
+        for (int Index = 0; Index < 16; ++Index) Arena.Allocate (64);
+    }
+    REQUIRE (Arena.Allocate (64) == Reused);
+    REQUIRE (Persistent != nullptr);
+
+    Z4GE::Arena Empty;
+    {
+        Z4GE::Arena::Frame Frame (Empty);
+        Empty.Allocate (8);
+    }
+    const Z4GE::Arena::Marker Rewound = Empty.Mark ();
+    REQUIRE (Empty.Allocate (8) == Rewound.Cursor);
+}
+
+#if Z4GE_ARENA_HAS_MEMORY_RESOURCE
+#    include <vector>
+
+TEST_CASE ("Arena memory resource", "[Arena]") {
+    Z4GE::Arena               Arena;
+    Z4GE::ArenaMemoryResource Resource (Arena);
+    std::pmr::vector<int>     Values (&Resource);
+    for (int Index = 0; Index < 1000; ++Index) Values.push_back (Index);
+    REQUIRE (Values[999] == 999);
+    REQUIRE (Arena.Capacity () >= 1000 * sizeof (int));
+}
+#endif
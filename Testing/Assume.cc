@@ -0,0 +1,80 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/AlignedAlloc.hh>
+#include <Z4GE/Configuration/Assume.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace {
+
+    enum Channel { Red, Green, Blue };
+
+    int Weight (Channel Value) {
+        switch (Value) {
+            case Red: return 3;
+            case Green: return 6;
+            case Blue: return 1;
+        }
+        Z4GE_UNREACHABLE ();
+    }
+
+    int Sum (const int* Values, std::size_t Count) {
+        Z4GE_ASSUME (Count % 4 == 0);
+        const int* Aligned = Z4GE_ASSUME_ALIGNED (Values, 16);
+
+        int Result = 0;
+        for (std::size_t Index = 0; Index < Count; ++Index) { Result += Aligned[Index]; }
+        return Result;
+    }
+
+} // namespace
+
+TEST_CASE ("Assume and unreachable hints", "[Assume]") {
+    REQUIRE (Weight (Red) == 3);
+    REQUIRE (Weight (Green) == 6);
+    REQUIRE (Weight (Blue) == 1);
+
+    int Value = 7;
+    Z4GE_ASSUME (Value == 7);
+    Z4GE_ASSUME (Value > 0 && Value < 8);
+    REQUIRE (Value == 7);
+}
+
+TEST_CASE ("Assume aligned hint", "[Assume]") {
+    int* Values = static_cast<int*> (Z4GE::AlignedAlloc (64 * sizeof (int), 64));
+    REQUIRE (Values != nullptr);
+    for (int Index = 0; Index < 64; ++Index) { Values[Index] = Index; }
+
+    STATIC_REQUIRE (std::is_same<decltype (Z4GE_ASSUME_ALIGNED (Values, 64)), int*>::value);
+    STATIC_REQUIRE (std::is_same<decltype (Z4GE_ASSUME_ALIGNED (static_cast<const int*> (Values), 64)), const int*>::value);
+    STATIC_REQUIRE (std::is_same<decltype (Z4GE_ASSUME_ALIGNED (static_cast<void*> (Values), 64)), void*>::value);
+
+    REQUIRE (Z4GE_ASSUME_ALIGNED (Values, 64) == Values);
+    REQUIRE (Z4GE_ASSUME_ALIGNED (Values + 4, 16) == Values + 4);
+    REQUIRE (Sum (Values, 64) == 64 * 63 / 2);
+
+    Z4GE::AlignedFree (Values, 64);
+}
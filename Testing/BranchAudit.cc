@@ -0,0 +1,102 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if !Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS
+#    error "BranchAudit.cc must be compiled with Z4GE_CONFIGURATION_AUDIT_BRANCH_HINTS"
+#endif
+
+namespace {
+
+    int Classify (int Value) {
+        if (Z4GE_LIKELY (Value >= 0)) { return 1; }
+        return 0;
+    }
+
+    int ClassifyWrongly (int Value) {
+        if (Z4GE_UNLIKELY (Value >= 0)) { return 1; }
+        return 0;
+    }
+
+    const Z4GE::BranchAudit::SiteReport* Find (const std::vector<Z4GE::BranchAudit::SiteReport>& Reports, bool Expected) {
+        for (std::size_t Index = 0; Index < Reports.size (); ++Index) {
+            if (Reports[Index].Expected == Expected && std::strstr (Reports[Index].File, "BranchAudit.cc") != nullptr) {
+                return &Reports[Index];
+            }
+        }
+        return nullptr;
+    }
+
+} // namespace
+
+TEST_CASE ("Audited hints evaluate to their expression", "[BranchAudit]") {
+    REQUIRE (Classify (3) == 1);
+    REQUIRE (Classify (-3) == 0);
+    REQUIRE (ClassifyWrongly (3) == 1);
+    REQUIRE (ClassifyWrongly (-3) == 0);
+}
+
+TEST_CASE ("Audited hints record outcomes across threads", "[BranchAudit]") {
+    //  The sites register on their first evaluation, which has to happen before the baseline is collected when this case
+    //  runs on its own
+    Classify (0);
+    ClassifyWrongly (0);
+
+    const std::vector<Z4GE::BranchAudit::SiteReport> Before = Z4GE::BranchAudit::Collect ();
+    const Z4GE::BranchAudit::SiteReport*             Likely = Find (Before, true);
+    REQUIRE (Likely != nullptr);
+    const std::uint64_t Taken = Likely->Taken, NotTaken = Likely->NotTaken;
+
+    std::vector<std::thread> Threads;
+    for (int Thread = 0; Thread < 4; ++Thread) {
+        Threads.push_back (std::thread ([] {
+            for (int Index = 0; Index < 1000; ++Index) {
+                Classify (Index % 10 == 0 ? -1 : 1);
+                ClassifyWrongly (Index);
+            }
+        }));
+    }
+    for (std::size_t Index = 0; Index < Threads.size (); ++Index) { Threads[Index].join (); }
+
+    const std::vector<Z4GE::BranchAudit::SiteReport> After = Z4GE::BranchAudit::Collect ();
+    const Z4GE::BranchAudit::SiteReport*             Hinted = Find (After, true);
+    const Z4GE::BranchAudit::SiteReport*             Wrong  = Find (After, false);
+    REQUIRE (Hinted != nullptr);
+    REQUIRE (Wrong != nullptr);
+
+    REQUIRE (Hinted->Taken - Taken == 3600);
+    REQUIRE (Hinted->NotTaken - NotTaken == 400);
+    REQUIRE_FALSE (Hinted->IsMispredicted ());
+    REQUIRE (Wrong->IsMispredicted ());
+    REQUIRE (Wrong->Misses () >= 4000);
+
+    //  The most mispredicted sites are reported first
+    REQUIRE (After.front ().MissRate () >= After.back ().MissRate ());
+}
@@ -0,0 +1,107 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/BuildNote.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+    //  Stores the little endian integer Value of Size bytes at Offset of Data
+    void Store (std::vector<unsigned char>& Data, std::size_t Offset, unsigned Size, unsigned long long Value) {
+        for (unsigned Byte = 0; Byte < Size; ++Byte) {
+            Data[Offset + Byte] = static_cast<unsigned char> (Value >> (Byte * 8));
+        }
+    }
+
+    //  Writes a little endian ELF64 header whose section headers follow it, the first one being a SHT_NOTE section of
+    //  NoteSize bytes that starts right after the header
+    bool WriteElf (const char* Path, unsigned SectionEntrySize, unsigned SectionCount, unsigned long long NoteSize) {
+        std::vector<unsigned char> Data (64 + 64, 0);
+        Store (Data, 0, 4, 0x464C457Fu);
+        Store (Data, 4, 3, 0x010102u);
+        Store (Data, 0x28, 8, 64);
+        Store (Data, 0x3A, 2, SectionEntrySize);
+        Store (Data, 0x3C, 2, SectionCount);
+        Store (Data, 64 + 4, 4, 7);
+        Store (Data, 64 + 0x18, 8, 64);
+        Store (Data, 64 + 0x20, 8, NoteSize);
+        Store (Data, 64 + 0x30, 8, 4);
+        std::ofstream File (Path, std::ios::binary);
+        return static_cast<bool> (File.write (reinterpret_cast<const char*> (&Data[0]),
+                                              static_cast<std::streamsize> (Data.size ())));
+    }
+
+} // namespace
+
+TEST_CASE ("Build Note Layout", "[buildnote]") {
+    REQUIRE (sizeof (Z4GE::Configuration::BuildNoteDescription) == 28);
+    REQUIRE (sizeof (Z4GE::Configuration::Detail::BuildNoteRecord) == 48);
+}
+
+TEST_CASE ("Build Note Reading", "[buildnote]") {
+    std::vector<Z4GE::Configuration::BuildNoteDescription> Notes;
+    REQUIRE_FALSE (Z4GE::Configuration::ReadBuildNotes ("Z4GE.Configuration.Missing", Notes));
+    REQUIRE (Notes.empty ());
+
+#if defined(__ELF__) && (Z4GE_PLATFORM & (Z4GE_PLATFORM_LINUX | Z4GE_PLATFORM_ANDROID))
+    //  This test is compiled with Z4GE_CONFIGURATION_BUILD_NOTE, therefore its executable carries the note of this file
+    REQUIRE (Z4GE::Configuration::ReadBuildNotes ("/proc/self/exe", Notes));
+    bool Found = false;
+    for (std::size_t Index = 0; Index < Notes.size (); ++Index) {
+        REQUIRE (Notes[Index].Version == Z4GE_BUILD_NOTE_VERSION);
+        Found = Found || (Notes[Index].Architecture == Z4GE_ARCHITECTURE && Notes[Index].Compiler == Z4GE_COMPILER &&
+                          Notes[Index].CompilerVersion == Z4GE_COMPILER_VERSION &&
+                          Notes[Index].BuildModel == Z4GE_BUILD_MODEL &&
+                          Notes[Index].Standard == Z4GE_BUILD_NOTE_STANDARD &&
+                          ((Notes[Index].Features & Z4GE::Configuration::BuildNoteConstexpr) != 0) == Z4GE_HAS_CONSTEXPR);
+    }
+    REQUIRE (Found);
+#endif
+}
+
+TEST_CASE ("Build Note Reading of Malformed Files", "[buildnote]") {
+    const char* const                                      Path = "Z4GE.Configuration.Malformed";
+    std::vector<Z4GE::Configuration::BuildNoteDescription> Notes;
+
+    //  A valid file without any note
+    REQUIRE (WriteElf (Path, 64, 1, 0));
+    REQUIRE (Z4GE::Configuration::ReadBuildNotes (Path, Notes));
+    REQUIRE (Notes.empty ());
+
+    //  Section headers beyond the end of the file, or overlapping each other
+    REQUIRE (WriteElf (Path, 64, 0xFFFF, 0));
+    REQUIRE_FALSE (Z4GE::Configuration::ReadBuildNotes (Path, Notes));
+    REQUIRE (WriteElf (Path, 1, 1, 0));
+    REQUIRE_FALSE (Z4GE::Configuration::ReadBuildNotes (Path, Notes));
+
+    //  A note section beyond the end of the file is skipped instead of being allocated
+    REQUIRE (WriteElf (Path, 64, 1, ~0ull));
+    REQUIRE (Z4GE::Configuration::ReadBuildNotes (Path, Notes));
+    REQUIRE (Notes.empty ());
+
+    std::remove (Path);
+}
@@ -0,0 +1,96 @@
+##  Z4GE.Configuration
+##  Copyright 2022 DeathBlizzard
+##  
+##  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+##  conditions are met:
+##  
+##  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+##      disclaimer.
+##  
+##  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+##      disclaimer in the documentation and/or other materials provided with the distribution.
+##  
+##  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+##      derived from this software without specific prior written permission.
+##  
+##  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+##  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+##  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+##  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+##  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+##  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+##  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+##  CMake Module Test
+##  Configures, builds and tests a case of the project in this directory, in a build tree of its own. This file is a CMake
+##  script that is run by the `CMake.<case>` tests (`cmake -P`) and expects the following variables
+##
+##  Z4GE_TESTING_CASE                   -   Case to be tested, see CMakeLists.txt
+##  Z4GE_TESTING_BINARY_DIRECTORY       -   Build tree of the case, which is recreated
+##  Z4GE_TESTING_GENERATOR              -   CMake generator of the build tree
+##  Z4GE_TESTING_COMPILER               -   C++ compiler
+##  Z4GE_TESTING_EXPECTED_ERROR         -   Regular expression of the error that the configuration is expected to fail with
+##  Z4GE_CONFIGURATION_ROOT_DIRECTORY   -   Root directory of the Z4GE.Configuration package
+##
+##  Cases that take several configurations of the same build tree (eg. instrumenting, training and optimizing) are run once
+##  per stage. Every stage builds the default targets, followed by the additional targets listed for it
+cmake_minimum_required(VERSION 3.11.0)
+
+foreach(VARIABLE CASE BINARY_DIRECTORY GENERATOR COMPILER)
+    if(NOT DEFINED Z4GE_TESTING_${VARIABLE})
+        message(FATAL_ERROR "[CMakeTesting] Z4GE_TESTING_${VARIABLE} is required")
+    endif()
+endforeach()
+
+set(STAGES DEFAULT)
+if(Z4GE_TESTING_CASE STREQUAL "ProfileGuidedOptimization")
+    set(STAGES INSTRUMENT OPTIMIZE)
+    set(STAGE_TARGETS_INSTRUMENT TrainProfile_Program)
+endif()
+
+##  Runs a step and fails the test with its output if the step fails
+function(z4ge_testing_step NAME OUTPUT_VARIABLE)
+    execute_process(
+        COMMAND ${ARGN}
+        WORKING_DIRECTORY ${Z4GE_TESTING_BINARY_DIRECTORY}
+        RESULT_VARIABLE STEP_RESULT
+        OUTPUT_VARIABLE STEP_OUTPUT
+        ERROR_VARIABLE  STEP_OUTPUT
+    )
+    message("${STEP_OUTPUT}")
+    set(${OUTPUT_VARIABLE} "${STEP_OUTPUT}" PARENT_SCOPE)
+    if(NOT STEP_RESULT EQUAL 0)
+        if(NAME STREQUAL "configure" AND Z4GE_TESTING_EXPECTED_ERROR)
+            return()
+        endif()
+        message(FATAL_ERROR "[CMakeTesting] ${Z4GE_TESTING_CASE}: ${NAME} failed (${STEP_RESULT})")
+    elseif(NAME STREQUAL "configure" AND Z4GE_TESTING_EXPECTED_ERROR)
+        message(FATAL_ERROR "[CMakeTesting] ${Z4GE_TESTING_CASE}: configure succeeded, expected an error matching "
+                            "\"${Z4GE_TESTING_EXPECTED_ERROR}\"")
+    endif()
+endfunction()
+
+file(REMOVE_RECURSE ${Z4GE_TESTING_BINARY_DIRECTORY})
+file(MAKE_DIRECTORY ${Z4GE_TESTING_BINARY_DIRECTORY})
+
+foreach(STAGE IN LISTS STAGES)
+    z4ge_testing_step(configure CONFIGURE_OUTPUT
+        ${CMAKE_COMMAND} -S ${CMAKE_CURRENT_LIST_DIR} -B ${Z4GE_TESTING_BINARY_DIRECTORY} -G ${Z4GE_TESTING_GENERATOR}
+        --no-warn-unused-cli -DCMAKE_CXX_COMPILER=${Z4GE_TESTING_COMPILER} -DCMAKE_BUILD_TYPE=Release
+        -DZ4GE_CONFIGURATION_ROOT_DIRECTORY=${Z4GE_CONFIGURATION_ROOT_DIRECTORY}
+        -DZ4GE_TESTING_CASE=${Z4GE_TESTING_CASE} -DZ4GE_TESTING_STAGE=${STAGE}
+    )
+    if(Z4GE_TESTING_EXPECTED_ERROR)
+        if(NOT CONFIGURE_OUTPUT MATCHES "${Z4GE_TESTING_EXPECTED_ERROR}")
+            message(FATAL_ERROR "[CMakeTesting] ${Z4GE_TESTING_CASE}: configure failed without an error matching "
+                                "\"${Z4GE_TESTING_EXPECTED_ERROR}\"")
+        endif()
+        return()
+    endif()
+    z4ge_testing_step(build BUILD_OUTPUT ${CMAKE_COMMAND} --build ${Z4GE_TESTING_BINARY_DIRECTORY})
+    foreach(TARGET IN LISTS STAGE_TARGETS_${STAGE})
+        z4ge_testing_step(build BUILD_OUTPUT ${CMAKE_COMMAND} --build ${Z4GE_TESTING_BINARY_DIRECTORY} --target ${TARGET})
+    endforeach()
+endforeach()
+
+z4ge_testing_step(test TEST_OUTPUT ${CMAKE_CTEST_COMMAND} --output-on-failure)
@@ -0,0 +1,52 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <cstdio>
+
+int Accumulate (const int* Values, int Count);
+
+//  Program of the CMake module tests. It prints the instruction set it was compiled for, which identifies the variant that a
+//  multi-ISA launcher executed, and fails unless the library computes the expected result
+int main () {
+#if defined(Z4GE_FORCE_X86_64_V4_INTRINSICS)
+    const char* const Level = "x86-64-v4";
+#elif defined(Z4GE_FORCE_X86_64_V3_INTRINSICS)
+    const char* const Level = "x86-64-v3";
+#elif defined(Z4GE_FORCE_X86_64_V2_INTRINSICS)
+    const char* const Level = "x86-64-v2";
+#elif defined(Z4GE_FORCE_SSE2_INTRINSICS)
+    const char* const Level = "x86-64-v1";
+#elif defined(Z4GE_FORCE_NEON_INTRINSICS)
+    const char* const Level = "neon";
+#elif defined(Z4GE_FORCE_ARM_INTRINSICS)
+    const char* const Level = "arm";
+#else
+    const char* const Level = "baseline";
+#endif
+    const int Values[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    const int Sum      = Accumulate (Values, 8);
+    std::printf ("Variant %s, sum %d\n", Level, Sum);
+    return Sum == 36 ? 0 : 1;
+}
@@ -0,0 +1,70 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//  Values of a few configuration macros. This unit is compiled twice: with Z4GE_TESTING_RESOLVED, Resolved.hh is included
+//  first and provides the resolved definitions, otherwise the headers evaluate their detection logic themselves
+#if defined(Z4GE_TESTING_RESOLVED)
+#    include <Z4GE/Configuration/Resolved.hh>
+#    define Z4GE_TESTING_VALUES ResolvedValues
+#else
+#    define Z4GE_TESTING_VALUES DirectValues
+#endif
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <Z4GE/Configuration/Platform.hh>
+
+#include <cstdio>
+
+void ResolvedValues (unsigned long long (&Values)[8]);
+void DirectValues (unsigned long long (&Values)[8]);
+
+void Z4GE_TESTING_VALUES (unsigned long long (&Values)[8]) {
+    const unsigned long long Current[] = {
+        Z4GE_ARCHITECTURE,  Z4GE_COMPILER,       Z4GE_COMPILER_VERSION,       Z4GE_PLATFORM,
+        Z4GE_BUILD_MODEL,   Z4GE_HAS_CONSTEXPR,  Z4GE_HAS_LAMBDA_EXPRESSIONS, Z4GE_HAS_RVALUE_REFERENCES,
+    };
+    for (unsigned Index = 0; Index < 8; ++Index) {
+        Values[Index] = Current[Index];
+    }
+}
+
+//  Fails unless the resolved definitions match the ones of the headers
+#if defined(Z4GE_TESTING_RESOLVED)
+int main () {
+    const char* const Names[] = {
+        "Z4GE_ARCHITECTURE", "Z4GE_COMPILER",      "Z4GE_COMPILER_VERSION",       "Z4GE_PLATFORM",
+        "Z4GE_BUILD_MODEL",  "Z4GE_HAS_CONSTEXPR", "Z4GE_HAS_LAMBDA_EXPRESSIONS", "Z4GE_HAS_RVALUE_REFERENCES",
+    };
+    unsigned long long Resolved[8], Direct[8];
+    ResolvedValues (Resolved);
+    DirectValues (Direct);
+    int Result = 0;
+    for (unsigned Index = 0; Index < 8; ++Index) {
+        if (Resolved[Index] != Direct[Index]) {
+            std::printf ("%s is resolved to %llu, expected %llu\n", Names[Index], Resolved[Index], Direct[Index]);
+            Result = 1;
+        }
+    }
+    std::printf ("%s\n", Result == 0 ? "Resolved definitions match" : "Resolved definitions differ");
+    return Result;
+}
+#endif
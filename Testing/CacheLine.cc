@@ -0,0 +1,71 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/CacheLine.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace {
+
+    struct Z4GE_CACHELINE_ALIGNED AlignedCounter {
+        std::uint64_t Value;
+    };
+
+} // namespace
+
+TEST_CASE ("Cache line constants", "[CacheLine]") {
+    STATIC_REQUIRE ((Z4GE_CACHELINE_SIZE & (Z4GE_CACHELINE_SIZE - 1)) == 0);
+    STATIC_REQUIRE ((Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE & (Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE - 1)) == 0);
+    STATIC_REQUIRE (Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE >= Z4GE_CACHELINE_SIZE);
+    STATIC_REQUIRE (Z4GE_CONSTRUCTIVE_INTERFERENCE_SIZE <= Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE);
+#if defined(__APPLE__) && defined(__aarch64__)
+    STATIC_REQUIRE (Z4GE_CACHELINE_SIZE == 128);
+#endif
+}
+
+TEST_CASE ("Cache line aligned types", "[CacheLine]") {
+    STATIC_REQUIRE (Z4GE_ALIGN_OF (AlignedCounter) == Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE);
+    STATIC_REQUIRE (sizeof (AlignedCounter) == Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE);
+}
+
+TEST_CASE ("Cache padded values", "[CacheLine]") {
+    typedef Z4GE::CachePadded<std::atomic<std::uint64_t>> Counter;
+    STATIC_REQUIRE (Z4GE_ALIGN_OF (Counter) == Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE);
+    STATIC_REQUIRE (sizeof (Counter) % Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE == 0);
+
+    Counter Counters[4];
+    for (std::size_t Index = 0; Index < 4; ++Index) Counters[Index]->store (Index);
+    Counters[2]->fetch_add (5);
+    REQUIRE (Counters[2]->load () == 7);
+    REQUIRE (reinterpret_cast<std::uintptr_t> (&Counters[1]) - reinterpret_cast<std::uintptr_t> (&Counters[0]) >=
+             Z4GE_DESTRUCTIVE_INTERFERENCE_SIZE);
+
+    Z4GE::CachePadded<std::string> Text (3, 'x');
+    REQUIRE (*Text == "xxx");
+    REQUIRE (Text->size () == 3);
+    Z4GE::CachePadded<std::string> Copy (Text);
+    REQUIRE (Copy.Get () == "xxx");
+}
@@ -0,0 +1,170 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/ColdPath.hh>
+#include <Z4GE/Configuration/CompilerTraits.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+namespace {
+
+    Z4GE_COLD std::string Describe (int Status) { return "Status " + std::to_string (Status); }
+
+    Z4GE_HOT Z4GE_FLATTEN int Scale (int Value) { return Value * 3; }
+
+#if Z4GE_PLATFORM & (Z4GE_PLATFORM_LINUX | Z4GE_PLATFORM_ANDROID)
+    Z4GE_SECTION (".text.z4ge_testing") int Placed (int Value) { return Value + 1; }
+#else
+    int Placed (int Value) { return Value + 1; }
+#endif
+
+    struct Empty {};
+
+    struct Holder {
+        int                          Value;
+        Z4GE_NO_UNIQUE_ADDRESS Empty Policy;
+    };
+
+    Z4GE_CONSTEXPR int Square (int Value) { return Value * Value; }
+
+    Z4GE_CONSTEVAL int Cube (int Value) { return Value * Value * Value; }
+
+    Z4GE_CONSTEXPR14 unsigned Hash (const char* Text) {
+        unsigned Value = 2166136261u;
+        while (*Text != '\0') {
+            Value = (Value ^ static_cast<unsigned char> (*Text++)) * 16777619u;
+        }
+        return Value;
+    }
+
+    Z4GE_CONSTEXPR17 int SumOfSquares (int Count) {
+        auto Squared = [] (int Value) { return Value * Value; };
+        int  Total   = 0;
+        for (int Index = 1; Index <= Count; ++Index) { Total += Squared (Index); }
+        return Total;
+    }
+
+    Z4GE_CONSTEXPR20 int Clamp (int Value, int Limit) {
+        int Result;
+        try {
+            Result = Value < Limit ? Value : Limit;
+        } catch (...) {
+            Result = 0;
+        }
+        return Result;
+    }
+
+    Z4GE_CONSTINIT int ConstantInitialized = 42;
+
+    int Tally () {
+        static Z4GE_CONSTINIT int Count = 0;
+        return ++Count;
+    }
+
+    int Bucket (int Value) {
+        Z4GE_ASSUME_ATTR (Value >= 0);
+        if (Value < 10) Z4GE_LIKELY_ATTR { return 0; }
+        if (Value < 100) Z4GE_UNLIKELY_ATTR { return 1; }
+        return 2;
+    }
+
+    int Process (int Value, std::string& Error) {
+        if (Z4GE_UNLIKELY (Value < 0)) {
+            Z4GE_COLD_PATH { Error = Describe (Value); };
+            return -1;
+        }
+        return Scale (Value);
+    }
+
+} // namespace
+
+TEST_CASE ("Hot, cold, flatten and section attributes", "[CompilerTraits]") {
+    REQUIRE (Scale (2) == 6);
+    REQUIRE (Placed (2) == 3);
+    REQUIRE (Describe (7) == "Status 7");
+}
+
+TEST_CASE ("Cold path blocks", "[CompilerTraits]") {
+    std::string Error;
+    REQUIRE (Process (5, Error) == 15);
+    REQUIRE (Error.empty ());
+
+    REQUIRE (Process (-2, Error) == -1);
+    REQUIRE (Error == "Status -2");
+
+    int Calls = 0;
+    for (int Index = 0; Index < 3; ++Index) {
+        Z4GE_COLD_PATH { ++Calls; };
+    }
+    REQUIRE (Calls == 3);
+}
+
+TEST_CASE ("Standard compliance flags", "[CompilerTraits]") {
+    STATIC_REQUIRE (Z4GE_CXX11_STANDARD_COMPLIANT);
+#if defined(__cplusplus) && __cplusplus >= 202002L
+    STATIC_REQUIRE (Z4GE_CXX20_STANDARD_COMPLIANT);
+#else
+    STATIC_REQUIRE (!Z4GE_CXX20_STANDARD_COMPLIANT);
+#endif
+#if Z4GE_CXX23_STANDARD_COMPLIANT
+    STATIC_REQUIRE (Z4GE_CXX20_STANDARD_COMPLIANT && Z4GE_CXX17_STANDARD_COMPLIANT);
+#endif
+#if Z4GE_CXX20_STANDARD_COMPLIANT
+    STATIC_REQUIRE (Z4GE_CXX17_STANDARD_COMPLIANT && Z4GE_CXX14_STANDARD_COMPLIANT);
+#endif
+}
+
+TEST_CASE ("Tiered constexpr specifiers", "[CompilerTraits]") {
+#if Z4GE_CXX14_STANDARD_COMPLIANT
+    STATIC_REQUIRE (Hash ("z4ge") == Hash ("z4ge"));
+    STATIC_REQUIRE (Hash ("") == 2166136261u);
+#endif
+#if Z4GE_CXX17_STANDARD_COMPLIANT
+    STATIC_REQUIRE (SumOfSquares (3) == 14);
+#endif
+#if Z4GE_CXX20_STANDARD_COMPLIANT
+    STATIC_REQUIRE (Clamp (7, 5) == 5);
+#endif
+    REQUIRE (Hash ("a") != Hash ("b"));
+    REQUIRE (SumOfSquares (4) == 30);
+    REQUIRE (Clamp (3, 5) == 3);
+}
+
+TEST_CASE ("CXX 20 / CXX 23 feature macros", "[CompilerTraits]") {
+    STATIC_REQUIRE (Square (4) == 16);
+    STATIC_REQUIRE (Cube (3) == 27);
+    REQUIRE (ConstantInitialized == 42);
+    REQUIRE (Tally () == 1);
+    REQUIRE (Tally () == 2);
+
+#if Z4GE_HAS_NO_UNIQUE_ADDRESS_ATTRIBUTE
+    STATIC_REQUIRE (sizeof (Holder) == sizeof (int));
+#endif
+    Holder Instance = {7, Empty ()};
+    REQUIRE (Instance.Value == 7);
+
+    REQUIRE (Bucket (5) == 0);
+    REQUIRE (Bucket (50) == 1);
+    REQUIRE (Bucket (500) == 2);
+}
@@ -0,0 +1,80 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/Dispatch.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_IX86) || defined(__i386__)
+namespace {
+
+    typedef int (*IdentifyFunction) (int);
+
+    int IdentifyBaseline (int Value) { return Value; }
+    Z4GE_TARGET ("sse4.2") int IdentifySSE42 (int Value) { return Value + Z4GE_ARCHITECTURE_BIT_SSE42; }
+    Z4GE_TARGET ("avx2") int IdentifyAVX2 (int Value) { return Value + Z4GE_ARCHITECTURE_BIT_AVX2; }
+
+    IdentifyFunction SelectIdentify (void) {
+        static const Z4GE::Configuration::DispatchCandidate<IdentifyFunction> Candidates[] = {
+            { Z4GE_ARCHITECTURE_BIT_AVX2, &IdentifyAVX2 },
+            { Z4GE_ARCHITECTURE_BIT_SSE42, &IdentifySSE42 },
+            { Z4GE_ARCHITECTURE_UNKNOWN, &IdentifyBaseline },
+        };
+        return Z4GE::Configuration::SelectImplementation (Candidates);
+    }
+
+    int ExpectedIdentify (int Value) {
+        if (Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_ARCHITECTURE_BIT_AVX2)) {
+            return Value + Z4GE_ARCHITECTURE_BIT_AVX2;
+        }
+        if (Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_ARCHITECTURE_BIT_SSE42)) {
+            return Value + Z4GE_ARCHITECTURE_BIT_SSE42;
+        }
+        return Value;
+    }
+
+} // namespace
+
+Z4GE_DISPATCH (int, Identify, (int Value), (Value), SelectIdentify)
+
+Z4GE_TARGET_CLONES ("avx2", "default") int Accumulate (const int* Values, int Count) {
+    int Sum = 0;
+    for (int Index = 0; Index < Count; ++Index) {
+        Sum += Values[Index];
+    }
+    return Sum;
+}
+
+TEST_CASE ("Dispatch Selection", "[dispatch]") {
+    REQUIRE (SelectIdentify() (0) == ExpectedIdentify (0));
+}
+
+TEST_CASE ("Dispatch Function", "[dispatch]") {
+    REQUIRE (Identify (1) == ExpectedIdentify (1));
+    REQUIRE (Identify (2) == ExpectedIdentify (2));
+}
+
+TEST_CASE ("Dispatch Target Clones", "[dispatch]") {
+    const int Values[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 };
+    REQUIRE (Accumulate (Values, 17) == 153);
+}
+#endif
@@ -0,0 +1,77 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/Features.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+namespace {
+
+    //  Selected at compile time, where the preprocessor cannot reach
+    template<typename Type, bool Enabled = Z4GE::Configuration::Features::HasArchitecture (Z4GE_ARCHITECTURE_X86_64_V3)>
+    typename std::enable_if<Enabled, int>::type SelectLevel (Type) {
+        return 3;
+    }
+
+    template<typename Type, bool Enabled = Z4GE::Configuration::Features::HasArchitecture (Z4GE_ARCHITECTURE_X86_64_V3)>
+    typename std::enable_if<!Enabled, int>::type SelectLevel (Type) {
+        return 0;
+    }
+
+    template<typename Type>
+    int SelectAVX2 (Type, std::true_type) {
+        return 2;
+    }
+
+    template<typename Type>
+    int SelectAVX2 (Type, std::false_type) {
+        return 0;
+    }
+
+} // namespace
+
+TEST_CASE ("Features mirror the Configuration Macros", "[features]") {
+    typedef Z4GE::Configuration::Features Features;
+    static_assert (Features::Architecture == Z4GE_ARCHITECTURE, "Architecture");
+    static_assert (Features::HasAVX2 == ((Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX2) != 0), "HasAVX2");
+    static_assert (Features::HasConstexpr == (Z4GE_HAS_CONSTEXPR != 0), "HasConstexpr");
+    static_assert (Features::HasIfConstexpr == (Z4GE_HAS_IF_CONSTEXPR != 0), "HasIfConstexpr");
+    static_assert (Features::HasStdAssumeAligned == (Z4GE_HAS_STD_ASSUME_ALIGNED != 0), "HasStdAssumeAligned");
+    static_assert (Features::BuildModel == Z4GE_BUILD_MODEL, "BuildModel");
+    static_assert (Features::Standard == Z4GE_CXX_STANDARD_LEVEL, "Standard");
+
+    //  Odr-uses of the members, which require their definitions before C++17
+    REQUIRE (Features::Compiler == Z4GE_COMPILER);
+    REQUIRE (Features::Is64Bit == (sizeof (void*) == 8));
+    REQUIRE (Features::Standard >= 11);
+}
+
+TEST_CASE ("Features x86-64 Levels", "[features]") {
+    typedef Z4GE::Configuration::Features Features;
+    REQUIRE (Features::HasX86_64_V3 == Features::HasArchitecture (Z4GE_ARCHITECTURE_X86_64_V3));
+    REQUIRE ((!Features::HasX86_64_V4 || Features::HasX86_64_V3));
+    REQUIRE ((!Features::HasX86_64_V3 || Features::HasX86_64_V2));
+    REQUIRE (SelectLevel (0) == (Features::HasX86_64_V3 ? 3 : 0));
+    REQUIRE (SelectAVX2 (0, std::integral_constant<bool, Features::HasAVX2> ()) == (Features::HasAVX2 ? 2 : 0));
+}
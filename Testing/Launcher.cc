@@ -0,0 +1,77 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/Launcher.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+    const Z4GE::Configuration::LaunchVariant Variants[] = {
+        { Z4GE_ARCHITECTURE_X86_64_V4, "x86-64-v4" },
+        { Z4GE_ARCHITECTURE_X86_64_V3, "x86-64-v3" },
+        { Z4GE_ARCHITECTURE_X86_64_V2, "x86-64-v2" },
+        { Z4GE_ARCHITECTURE_UNKNOWN, "baseline" },
+    };
+
+    void SetLaunchVariant (const char* Variant) {
+#if Z4GE_PLATFORM & Z4GE_PLATFORM_WINDOWS
+        _putenv_s ("Z4GE_LAUNCH_VARIANT", Variant);
+#else
+        setenv ("Z4GE_LAUNCH_VARIANT", Variant, 1);
+#endif
+    }
+
+} // namespace
+
+TEST_CASE ("Launcher Variant Selection", "[launcher]") {
+    SetLaunchVariant ("");
+    const Z4GE::Configuration::LaunchVariant* Variant = Z4GE::Configuration::SelectLaunchVariant (Variants);
+    REQUIRE (Variant != nullptr);
+    REQUIRE (std::string (Variant->Implementation) == Z4GE::Configuration::SelectImplementation (Variants));
+    REQUIRE (Z4GE::Configuration::HasRuntimeArchitecture (Variant->Architecture));
+}
+
+TEST_CASE ("Launcher Forced Variant", "[launcher]") {
+    SetLaunchVariant ("baseline");
+    const Z4GE::Configuration::LaunchVariant* Variant = Z4GE::Configuration::SelectLaunchVariant (Variants);
+    REQUIRE (Variant == &Variants[3]);
+
+    SetLaunchVariant ("x86-64-v9");
+    REQUIRE (Z4GE::Configuration::SelectLaunchVariant (Variants) == nullptr);
+
+    SetLaunchVariant ("x86-64-v4");
+    Variant = Z4GE::Configuration::SelectLaunchVariant (Variants);
+    REQUIRE ((Variant != nullptr) == Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_ARCHITECTURE_X86_64_V4));
+    SetLaunchVariant ("");
+}
+
+TEST_CASE ("Launcher Variant Path", "[launcher]") {
+    using Z4GE::Configuration::Detail::GetVariantPath;
+    REQUIRE (GetVariantPath ("/opt/bin/Server", "Server", "x86-64-v3") ==
+             "/opt/bin/Server.x86-64-v3" Z4GE_LAUNCHER_EXECUTABLE_SUFFIX);
+    REQUIRE (GetVariantPath ("Server", "Server", "x86-64-v2") == "Server.x86-64-v2" Z4GE_LAUNCHER_EXECUTABLE_SUFFIX);
+    REQUIRE (!Z4GE::Configuration::Detail::GetExecutablePath (nullptr).empty ());
+}
@@ -0,0 +1,58 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/Prefetch.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <vector>
+
+TEST_CASE ("Prefetch macros", "[Prefetch]") {
+    int Value = 42;
+    Z4GE_PREFETCH_READ (&Value, 0);
+    Z4GE_PREFETCH_READ (&Value, 1);
+    Z4GE_PREFETCH_READ (&Value, 2);
+    Z4GE_PREFETCH_READ (&Value, 3);
+    Z4GE_PREFETCH_WRITE (&Value, 0);
+    Z4GE_PREFETCH_WRITE (&Value, 3);
+
+    //  Prefetches are hints and never fault, nor change the memory they touch
+    Z4GE_PREFETCH_READ (&Value + 1, 3);
+    REQUIRE (Value == 42);
+}
+
+TEST_CASE ("Prefetch ranges", "[Prefetch]") {
+    std::vector<double> Values (1000, 1.0);
+
+    Z4GE::PrefetchRange (Values.data (), Values.size ());
+    Z4GE::PrefetchRange<0> (Values.data () + 3, 17);
+    Z4GE::PrefetchRangeForWrite (Values.data (), Values.size ());
+    Z4GE::PrefetchRangeForWrite<1> (Values.data () + 1, std::size_t (1));
+
+    const double* Empty = nullptr;
+    Z4GE::PrefetchRange (Empty, 0);
+
+    double Sum = 0.0;
+    for (std::size_t Index = 0; Index < Values.size (); ++Index) { Sum += Values[Index]; }
+    REQUIRE (Sum == 1000.0);
+}
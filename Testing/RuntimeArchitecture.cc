@@ -0,0 +1,77 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/RuntimeArchitecture.hh>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE ("Runtime Architecture Identification", "[architecture]") {
+    const Z4GE::Configuration::ArchitectureMask Architecture = Z4GE::Configuration::GetRuntimeArchitecture();
+    REQUIRE (Architecture == Z4GE::Configuration::Detail::DetectRuntimeArchitecture());
+    REQUIRE (Architecture == Z4GE::Configuration::GetRuntimeArchitecture());
+}
+
+TEST_CASE ("Runtime Architecture satisfies Compile-time Architecture", "[architecture]") {
+    //  The test binary is executing, therefore every feature it was compiled for must be present on the host
+    REQUIRE (Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_ARCHITECTURE));
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+TEST_CASE ("Runtime Architecture x86-64 Baseline", "[architecture]") {
+    REQUIRE (Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_ARCHITECTURE_SSE2));
+}
+#endif
+
+TEST_CASE ("Runtime Architecture x86-64 Microarchitecture Levels", "[architecture]") {
+    //  Each psABI level is a strict superset of the previous one
+    if (Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_ARCHITECTURE_X86_64_V4)) {
+        REQUIRE (Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_ARCHITECTURE_X86_64_V3));
+    }
+    if (Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_ARCHITECTURE_X86_64_V3)) {
+        REQUIRE (Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_ARCHITECTURE_X86_64_V2));
+    }
+    REQUIRE ((Z4GE_ARCHITECTURE_X86_64_V4 & Z4GE_ARCHITECTURE_X86_64_V3) == Z4GE_ARCHITECTURE_X86_64_V3);
+    REQUIRE ((Z4GE_ARCHITECTURE_X86_64_V3 & Z4GE_ARCHITECTURE_X86_64_V2) == Z4GE_ARCHITECTURE_X86_64_V2);
+}
+
+#if defined(Z4GE_FORCE_INTRINSICS)
+TEST_CASE ("Compile-time Architecture from the predefined macros", "[architecture]") {
+    //  Every instruction set enabled by the compiler options is reported on its own, regardless of the psABI levels
+    STATIC_REQUIRE ((Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_PREDEFINED_SSE42) == Z4GE_ARCHITECTURE_PREDEFINED_SSE42);
+    STATIC_REQUIRE ((Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_PREDEFINED_AVX2) == Z4GE_ARCHITECTURE_PREDEFINED_AVX2);
+    STATIC_REQUIRE ((Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_PREDEFINED_POPCNT) == Z4GE_ARCHITECTURE_PREDEFINED_POPCNT);
+    STATIC_REQUIRE ((Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_PREDEFINED_BMI2) == Z4GE_ARCHITECTURE_PREDEFINED_BMI2);
+    STATIC_REQUIRE ((Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_PREDEFINED_FMA) == Z4GE_ARCHITECTURE_PREDEFINED_FMA);
+    STATIC_REQUIRE ((Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_PREDEFINED_AVX512F) == Z4GE_ARCHITECTURE_PREDEFINED_AVX512F);
+    STATIC_REQUIRE ((Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_PREDEFINED_NEON) == Z4GE_ARCHITECTURE_PREDEFINED_NEON);
+#    if defined(__AVX2__)
+    STATIC_REQUIRE (Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_BIT_AVX2);
+#    endif
+#    if defined(__AVX2__) && !defined(__BMI2__)
+    STATIC_REQUIRE ((Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_X86_64_V3) != Z4GE_ARCHITECTURE_X86_64_V3);
+#    endif
+#    if defined(__x86_64__) || defined(_M_X64)
+    STATIC_REQUIRE ((Z4GE_ARCHITECTURE & Z4GE_ARCHITECTURE_X86_64_V1) == Z4GE_ARCHITECTURE_X86_64_V1);
+#    endif
+    REQUIRE (Z4GE::Configuration::HasRuntimeArchitecture (Z4GE_ARCHITECTURE));
+}
+#endif
@@ -0,0 +1,182 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/Simd.hh>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+    template<typename VectorType>
+    struct Reference {
+        typedef typename VectorType::ValueType T;
+        static Z4GE_CONSTEXPR_OR_CONST std::size_t N = VectorType::Lanes;
+
+        Z4GE_ALIGN_AS (64) T Lhs[N];
+        Z4GE_ALIGN_AS (64) T Rhs[N];
+        Z4GE_ALIGN_AS (64) T Result[N];
+
+        Reference (void) {
+            for (std::size_t Index = 0; Index < N; ++Index) {
+                Lhs[Index] = static_cast<T> (static_cast<int> (Index * 7 % 11) - 5);
+                Rhs[Index] = static_cast<T> (static_cast<int> (Index * 3 % 5) - 2);
+            }
+            Rhs[0] = Lhs[0];
+        }
+    };
+
+    template<typename VectorType>
+    void CheckCommon (void) {
+        typedef typename VectorType::ValueType T;
+        typedef typename VectorType::MaskType  MaskType;
+        const std::size_t                      N = VectorType::Lanes;
+
+        Reference<VectorType> Data;
+        const VectorType      Lhs = VectorType::Load (Data.Lhs);
+        const VectorType      Rhs = VectorType::LoadAligned (Data.Rhs);
+
+        (Lhs + Rhs).StoreAligned (Data.Result);
+        for (std::size_t Index = 0; Index < N; ++Index) REQUIRE (Data.Result[Index] == T (Data.Lhs[Index] + Data.Rhs[Index]));
+        (Lhs - Rhs).Store (Data.Result);
+        for (std::size_t Index = 0; Index < N; ++Index) REQUIRE (Data.Result[Index] == T (Data.Lhs[Index] - Data.Rhs[Index]));
+
+        const VectorType Minimum = Min (Lhs, Rhs);
+        const VectorType Maximum = Max (Lhs, Rhs);
+        for (std::size_t Index = 0; Index < N; ++Index) {
+            REQUIRE (Minimum[Index] == (Data.Rhs[Index] < Data.Lhs[Index] ? Data.Rhs[Index] : Data.Lhs[Index]));
+            REQUIRE (Maximum[Index] == (Data.Lhs[Index] < Data.Rhs[Index] ? Data.Rhs[Index] : Data.Lhs[Index]));
+        }
+
+        const MaskType Less    = Lhs < Rhs;
+        const MaskType Equal   = Lhs == Rhs;
+        const MaskType Greater = Lhs > Rhs;
+        std::uint64_t  LessBits = 0, EqualBits = 0, GreaterBits = 0;
+        for (std::size_t Index = 0; Index < N; ++Index) {
+            LessBits |= std::uint64_t (Data.Lhs[Index] < Data.Rhs[Index]) << Index;
+            EqualBits |= std::uint64_t (Data.Lhs[Index] == Data.Rhs[Index]) << Index;
+            GreaterBits |= std::uint64_t (Data.Lhs[Index] > Data.Rhs[Index]) << Index;
+        }
+        REQUIRE (Less.ToBits () == LessBits);
+        REQUIRE (Equal.ToBits () == EqualBits);
+        REQUIRE (Greater.ToBits () == GreaterBits);
+        REQUIRE ((Lhs <= Rhs).ToBits () == (LessBits | EqualBits));
+        REQUIRE ((Lhs >= Rhs).ToBits () == (GreaterBits | EqualBits));
+        REQUIRE ((Lhs != Rhs).ToBits () == (LessBits | GreaterBits));
+        REQUIRE ((Less | Equal | Greater).All ());
+        REQUIRE ((Less & Greater).None ());
+        REQUIRE ((Less ^ ~Less).All ());
+        REQUIRE (Equal.Any ());
+
+        const VectorType Selected = Select (Less, Lhs, Rhs);
+        for (std::size_t Index = 0; Index < N; ++Index) REQUIRE (Selected[Index] == Minimum[Index]);
+
+        typename VectorType::SumType Sum = 0;
+        T                            Low = Data.Lhs[0], High = Data.Lhs[0];
+        for (std::size_t Index = 0; Index < N; ++Index) {
+            Sum  = static_cast<typename VectorType::SumType> (Sum + Data.Lhs[Index]);
+            Low  = Data.Lhs[Index] < Low ? Data.Lhs[Index] : Low;
+            High = Data.Lhs[Index] > High ? Data.Lhs[Index] : High;
+        }
+        REQUIRE (Lhs.ReduceAdd () == Sum);
+        REQUIRE (Lhs.ReduceMin () == Low);
+        REQUIRE (Lhs.ReduceMax () == High);
+        REQUIRE (VectorType::Zero ().ReduceAdd () == 0);
+        REQUIRE (VectorType (T (3)).ReduceAdd () == typename VectorType::SumType (3 * N));
+    }
+
+    template<typename VectorType>
+    void CheckMultiplyShuffle (void) {
+        typedef typename VectorType::ValueType T;
+        const std::size_t                      N = VectorType::Lanes;
+
+        Reference<VectorType> Data;
+        const VectorType      Lhs = VectorType::Load (Data.Lhs);
+        const VectorType      Rhs = VectorType::Load (Data.Rhs);
+
+        const VectorType Product = Lhs * Rhs;
+        for (std::size_t Index = 0; Index < N; ++Index) REQUIRE (Product[Index] == T (Data.Lhs[Index] * Data.Rhs[Index]));
+
+        const VectorType Shuffled = Lhs.template Shuffle<3, 0, 2, 1> ();
+        for (std::size_t Group = 0; Group < N; Group += 4) {
+            REQUIRE (Shuffled[Group + 0] == Data.Lhs[Group + 3]);
+            REQUIRE (Shuffled[Group + 1] == Data.Lhs[Group + 0]);
+            REQUIRE (Shuffled[Group + 2] == Data.Lhs[Group + 2]);
+            REQUIRE (Shuffled[Group + 3] == Data.Lhs[Group + 1]);
+        }
+    }
+
+    template<typename VectorType>
+    void CheckDivide (void) {
+        const VectorType Quotient = VectorType (6.0f) / VectorType (2.0f);
+        for (std::size_t Index = 0; Index < VectorType::Lanes; ++Index) REQUIRE (Quotient[Index] == 3.0f);
+    }
+
+} // namespace
+
+TEST_CASE ("Floating point vectors", "[Simd]") {
+    CheckCommon<Z4GE::Simd::Float32x4> ();
+    CheckCommon<Z4GE::Simd::Float32x8> ();
+    CheckCommon<Z4GE::Simd::Float32x16> ();
+    CheckMultiplyShuffle<Z4GE::Simd::Float32x4> ();
+    CheckMultiplyShuffle<Z4GE::Simd::Float32x8> ();
+    CheckMultiplyShuffle<Z4GE::Simd::Float32x16> ();
+    CheckDivide<Z4GE::Simd::Float32x4> ();
+    CheckDivide<Z4GE::Simd::Float32x8> ();
+    CheckDivide<Z4GE::Simd::Float32x16> ();
+}
+
+TEST_CASE ("32-bit integer vectors", "[Simd]") {
+    CheckCommon<Z4GE::Simd::Int32x4> ();
+    CheckCommon<Z4GE::Simd::Int32x8> ();
+    CheckCommon<Z4GE::Simd::Int32x16> ();
+    CheckMultiplyShuffle<Z4GE::Simd::Int32x4> ();
+    CheckMultiplyShuffle<Z4GE::Simd::Int32x8> ();
+    CheckMultiplyShuffle<Z4GE::Simd::Int32x16> ();
+}
+
+TEST_CASE ("8-bit integer vectors", "[Simd]") {
+    CheckCommon<Z4GE::Simd::Int8x16> ();
+    CheckCommon<Z4GE::Simd::Int8x32> ();
+    CheckCommon<Z4GE::Simd::Int8x64> ();
+}
+
+TEST_CASE ("Instruction set of the vectors", "[Simd]") {
+    //  Each SimdTesting_<level> variant has to compile the intrinsics path of its level rather than the scalar fallback
+#if defined(Z4GE_FORCE_X86_64_V4_INTRINSICS)
+    STATIC_REQUIRE (Z4GE_SIMD_AVX512F);
+    STATIC_REQUIRE (Z4GE_SIMD_AVX512BW);
+#endif
+#if defined(Z4GE_FORCE_X86_64_V3_INTRINSICS) || defined(Z4GE_FORCE_X86_64_V4_INTRINSICS)
+    STATIC_REQUIRE (Z4GE_SIMD_AVX2);
+#endif
+#if defined(Z4GE_FORCE_SSE2_INTRINSICS) || defined(Z4GE_FORCE_X86_64_V2_INTRINSICS) ||                                     \
+    defined(Z4GE_FORCE_X86_64_V3_INTRINSICS) || defined(Z4GE_FORCE_X86_64_V4_INTRINSICS)
+    STATIC_REQUIRE (Z4GE_SIMD_SSE2);
+#endif
+#if defined(Z4GE_FORCE_NEON_INTRINSICS)
+    STATIC_REQUIRE (Z4GE_SIMD_NEON);
+#endif
+    REQUIRE (Z4GE::Simd::Float32x16::Lanes == 16);
+}
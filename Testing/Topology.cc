@@ -0,0 +1,77 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <Z4GE/Configuration/Topology.hh>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE ("CPU list parsing", "[topology]") {
+    const std::vector<unsigned> Cpus = Z4GE::Configuration::Detail::ParseCpuList ("0-3,8,10-11\n");
+    const unsigned              Expected[] = { 0, 1, 2, 3, 8, 10, 11 };
+    REQUIRE (Cpus == std::vector<unsigned> (Expected, Expected + 7));
+    REQUIRE (Z4GE::Configuration::Detail::ParseCpuList ("").empty ());
+}
+
+TEST_CASE ("Cache size parsing", "[topology]") {
+    REQUIRE (Z4GE::Configuration::Detail::ParseCacheSize ("48K") == 48u * 1024u);
+    REQUIRE (Z4GE::Configuration::Detail::ParseCacheSize ("32M") == 32u * 1024u * 1024u);
+    REQUIRE (Z4GE::Configuration::Detail::ParseCacheSize ("512") == 512u);
+}
+
+TEST_CASE ("Hardware topology snapshot", "[topology]") {
+    const Z4GE::Configuration::Topology& Topology = Z4GE::Configuration::GetTopology ();
+    REQUIRE (&Topology == &Z4GE::Configuration::GetTopology ());
+
+    REQUIRE (Topology.LogicalCpus >= 1);
+    REQUIRE (Topology.PhysicalCores >= 1);
+    REQUIRE (Topology.PhysicalCores <= Topology.LogicalCpus);
+    REQUIRE (Topology.Packages >= 1);
+    REQUIRE (Topology.NumaNodes >= 1);
+    REQUIRE (Topology.SmtSiblings.size () == Topology.PhysicalCores);
+    REQUIRE (Topology.NumaNodeCpus.size () == Topology.NumaNodes);
+
+    std::size_t Threads = 0;
+    for (std::size_t Index = 0; Index < Topology.SmtSiblings.size (); ++Index) Threads += Topology.SmtSiblings[Index].size ();
+    REQUIRE (Threads == Topology.LogicalCpus);
+
+    for (std::size_t Index = 0; Index < Topology.Caches.size (); ++Index) {
+        REQUIRE (Topology.Caches[Index].Level >= 1);
+        REQUIRE (Topology.Caches[Index].Size > 0);
+        REQUIRE (Topology.Caches[Index].SharingCount >= 1);
+        if (Index) REQUIRE (Topology.Caches[Index - 1].Level <= Topology.Caches[Index].Level);
+    }
+    if (const Z4GE::Configuration::CacheInfo* L1 = Topology.FindDataCache (1)) {
+        REQUIRE (L1->Type != Z4GE::Configuration::InstructionCache);
+        REQUIRE (Topology.DataCacheSize (1) == L1->Size);
+    }
+    REQUIRE (Topology.DataCacheSize (9) == 0);
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+TEST_CASE ("CPUID cache parameters", "[topology]") {
+    const std::vector<Z4GE::Configuration::CacheInfo> Caches = Z4GE::Configuration::Detail::DetectCachesCpuid ();
+    for (std::size_t Index = 0; Index < Caches.size (); ++Index) {
+        REQUIRE (Caches[Index].LineSize >= 32);
+        REQUIRE (Caches[Index].Size % Caches[Index].LineSize == 0);
+    }
+}
+#endif
@@ -0,0 +1,236 @@
+//  Z4GE.Configuration
+//  Copyright 2022 DeathBlizzard
+//
+//  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following
+//  conditions are met:
+//
+//  1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+//      disclaimer.
+//
+//  2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+//      disclaimer in the documentation and/or other materials provided with the distribution.
+//
+//  3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products
+//      derived from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+//  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+//  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+//  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//  BuildNoteReader [--json] [--minimum <level>] <file>...
+//
+//  Prints the build notes (see Z4GE/Configuration/BuildNote.hh) of ELF files without executing them. With --minimum, every
+//  note has to include the architecture of an instruction set level (eg. x86-64-v3), which catches the translation units that
+//  were accidentally compiled for a more conservative level. Exits with 1 if a file has no note or fails --minimum, and with
+//  2 if a file is not a readable ELF file.
+#include <Z4GE/Configuration/ArchitectureGuard.hh>
+#include <Z4GE/Configuration/BuildNote.hh>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct ArchitectureLevel {
+        const char*                           Name;
+        Z4GE::Configuration::ArchitectureMask Architecture;
+    };
+
+    //  Ordered from the most to the least demanding level of each family
+    const ArchitectureLevel Levels[] = {
+        { "avx512vnni", Z4GE_ARCHITECTURE_AVX512VNNI },
+        { "x86-64-v4", Z4GE_ARCHITECTURE_X86_64_V4 },
+        { "x86-64-v3", Z4GE_ARCHITECTURE_X86_64_V3 },
+        { "avx2", Z4GE_ARCHITECTURE_AVX2 },
+        { "avx", Z4GE_ARCHITECTURE_AVX },
+        { "x86-64-v2", Z4GE_ARCHITECTURE_X86_64_V2 },
+        { "sse4.2", Z4GE_ARCHITECTURE_SSE42 },
+        { "sse4.1", Z4GE_ARCHITECTURE_SSE41 },
+        { "ssse3", Z4GE_ARCHITECTURE_SSSE3 },
+        { "sse3", Z4GE_ARCHITECTURE_SSE3 },
+        { "x86-64-v1", Z4GE_ARCHITECTURE_X86_64_V1 },
+        { "sse", Z4GE_ARCHITECTURE_SSE },
+        { "x86", Z4GE_ARCHITECTURE_X86 },
+        { "armv8", Z4GE_ARCHITECTURE_ARMV8 },
+        { "neon", Z4GE_ARCHITECTURE_NEON },
+        { "arm", Z4GE_ARCHITECTURE_ARM },
+    };
+
+    //  Indexed by the bits of Z4GE::Configuration::BuildNoteFeature
+    const char* const FeatureNames[] = {
+        "constexpr",
+        "noexcept",
+        "if_constexpr",
+        "constinit",
+        "consteval",
+        "aligned_new",
+        "likely_attribute",
+        "assume_attribute",
+        "no_unique_address",
+        "target_attribute",
+        "target_clones",
+        "ifunc_attribute",
+        "audit_branch_hints",
+    };
+
+    //  The most demanding level whose architecture is included in Architecture
+    const char* GetLevelName (Z4GE::Configuration::ArchitectureMask Architecture) {
+        for (std::size_t Index = 0; Index < sizeof (Levels) / sizeof (Levels[0]); ++Index) {
+            if ((Architecture & Levels[Index].Architecture) == Levels[Index].Architecture) {
+                return Levels[Index].Name;
+            }
+        }
+        return "unknown";
+    }
+
+    const char* GetCompilerName (std::uint32_t Compiler) {
+        switch (Compiler) {
+            case Z4GE_COMPILER_LLVM_CLANG: return "LLVM Clang";
+            case Z4GE_COMPILER_APPLE_CLANG: return "Apple Clang";
+            case Z4GE_COMPILER_GCC: return "GCC";
+            case Z4GE_COMPILER_MSVC: return "MSVC";
+            case Z4GE_COMPILER_INTEL: return "Intel";
+            case Z4GE_COMPILER_NVCC: return "NVCC";
+            default: return "Unknown";
+        }
+    }
+
+    std::string GetCompilerVersion (const Z4GE::Configuration::BuildNoteDescription& Note) {
+        char Version[32];
+        if (Note.Compiler & (Z4GE_COMPILER_LLVM_CLANG | Z4GE_COMPILER_APPLE_CLANG | Z4GE_COMPILER_GCC)) {
+            std::snprintf (Version, sizeof (Version), "%u.%u.%u", Note.CompilerVersion / 10000,
+                           Note.CompilerVersion / 100 % 100, Note.CompilerVersion % 100);
+        } else {
+            std::snprintf (Version, sizeof (Version), "%u", Note.CompilerVersion);
+        }
+        return Version;
+    }
+
+    bool IsSameNote (const Z4GE::Configuration::BuildNoteDescription& Left,
+                     const Z4GE::Configuration::BuildNoteDescription& Right) {
+        return Left.Version == Right.Version && Left.Architecture == Right.Architecture && Left.Compiler == Right.Compiler &&
+               Left.CompilerVersion == Right.CompilerVersion && Left.BuildModel == Right.BuildModel &&
+               Left.Standard == Right.Standard && Left.Features == Right.Features;
+    }
+
+    void PrintText (const Z4GE::Configuration::BuildNoteDescription& Note) {
+        std::printf ("    Architecture    %s (0x%x)", GetLevelName (Note.Architecture), Note.Architecture);
+        for (Z4GE::Configuration::ArchitectureMask Bit = 1; Bit != 0; Bit <<= 1) {
+            const char* Name = Z4GE::Configuration::GetArchitectureFeatureName (Bit);
+            if ((Note.Architecture & Bit) && Name != nullptr) {
+                std::printf (" %s", Name);
+            }
+        }
+        std::printf ("\n    Compiler        %s %s\n", GetCompilerName (Note.Compiler), GetCompilerVersion (Note).c_str ());
+        std::printf ("    Build Model     %s\n", Note.BuildModel == Z4GE_BUILD_MODEL_64 ? "64-bit" : "32-bit");
+        std::printf ("    Standard        C++%02u\n    Features       ", Note.Standard);
+        for (std::size_t Index = 0; Index < sizeof (FeatureNames) / sizeof (FeatureNames[0]); ++Index) {
+            if (Note.Features & (1u << Index)) {
+                std::printf (" %s", FeatureNames[Index]);
+            }
+        }
+        std::printf ("\n");
+    }
+
+    void PrintJson (const Z4GE::Configuration::BuildNoteDescription& Note) {
+        std::printf ("{\"level\": \"%s\", \"architecture\": %u, \"compiler\": \"%s\", \"compiler_version\": \"%s\", "
+                     "\"build_model\": %u, \"standard\": %u, \"features\": [",
+                     GetLevelName (Note.Architecture), Note.Architecture, GetCompilerName (Note.Compiler),
+                     GetCompilerVersion (Note).c_str (), Note.BuildModel == Z4GE_BUILD_MODEL_64 ? 64u : 32u, Note.Standard);
+        const char* Separator = "";
+        for (std::size_t Index = 0; Index < sizeof (FeatureNames) / sizeof (FeatureNames[0]); ++Index) {
+            if (Note.Features & (1u << Index)) {
+                std::printf ("%s\"%s\"", Separator, FeatureNames[Index]);
+                Separator = ", ";
+            }
+        }
+        std::printf ("]}");
+    }
+
+} // namespace
+
+int main (int ArgumentCount, char** Arguments) {
+    bool                     Json    = false;
+    const ArchitectureLevel* Minimum = nullptr;
+    std::vector<const char*> Files;
+    for (int Index = 1; Index < ArgumentCount; ++Index) {
+        if (std::strcmp (Arguments[Index], "--json") == 0) {
+            Json = true;
+        } else if (std::strcmp (Arguments[Index], "--minimum") == 0 && Index + 1 < ArgumentCount) {
+            const char* Name = Arguments[++Index];
+            for (std::size_t Level = 0; Level < sizeof (Levels) / sizeof (Levels[0]); ++Level) {
+                if (std::strcmp (Name, Levels[Level].Name) == 0) {
+                    Minimum = &Levels[Level];
+                }
+            }
+            if (Minimum == nullptr) {
+                std::fprintf (stderr, "BuildNoteReader: unknown level %s\n", Name);
+                return 2;
+            }
+        } else {
+            Files.push_back (Arguments[Index]);
+        }
+    }
+    if (Files.empty ()) {
+        std::fprintf (stderr, "usage: BuildNoteReader [--json] [--minimum <level>] <file>...\n");
+        return 2;
+    }
+
+    int Status = 0;
+    if (Json) {
+        std::printf ("[");
+    }
+    for (std::size_t File = 0; File < Files.size (); ++File) {
+        std::vector<Z4GE::Configuration::BuildNoteDescription> Notes, UniqueNotes;
+        if (!Z4GE::Configuration::ReadBuildNotes (Files[File], Notes)) {
+            std::fprintf (stderr, "BuildNoteReader: %s is not a readable ELF file\n", Files[File]);
+            Status = 2;
+            continue;
+        }
+        for (std::size_t Note = 0; Note < Notes.size (); ++Note) {
+            bool Unique = true;
+            for (std::size_t Other = 0; Other < UniqueNotes.size () && Unique; ++Other) {
+                Unique = !IsSameNote (Notes[Note], UniqueNotes[Other]);
+            }
+            if (Unique) {
+                UniqueNotes.push_back (Notes[Note]);
+            }
+        }
+
+        if (Json) {
+            std::printf ("%s\n  {\"file\": \"%s\", \"notes\": [", File == 0 ? "" : ",", Files[File]);
+        } else {
+            std::printf ("%s: %u build note(s)\n", Files[File], static_cast<unsigned> (UniqueNotes.size ()));
+        }
+        for (std::size_t Note = 0; Note < UniqueNotes.size (); ++Note) {
+            if (Json) {
+                std::printf ("%s", Note == 0 ? "" : ", ");
+                PrintJson (UniqueNotes[Note]);
+            } else {
+                PrintText (UniqueNotes[Note]);
+            }
+            if (Minimum != nullptr && (UniqueNotes[Note].Architecture & Minimum->Architecture) != Minimum->Architecture) {
+                std::fprintf (stderr, "BuildNoteReader: %s contains code compiled for %s, below %s\n", Files[File],
+                              GetLevelName (UniqueNotes[Note].Architecture), Minimum->Name);
+                Status = Status == 0 ? 1 : Status;
+            }
+        }
+        if (Json) {
+            std::printf ("]}");
+        }
+        if (UniqueNotes.empty ()) {
+            std::fprintf (stderr, "BuildNoteReader: %s has no build note\n", Files[File]);
+            Status = Status == 0 ? 1 : Status;
+        }
+    }
+    if (Json) {
+        std::printf ("\n]\n");
+    }
+    return Status;
+}